@@ -0,0 +1,39 @@
+#include "Arduino.h"
+#include <stdarg.h>
+#include <chrono>
+
+HostSerial Serial;
+
+static uint64_t hostClockOffsetUs = 0;
+static bool hostClockFrozen = false;  // wall clock left out, see hostClockSimulated()
+static uint64_t hostFrozenWallUs;
+
+uint64_t hostNanos() {
+  static const auto start = std::chrono::steady_clock::now();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+static uint64_t hostNowUs() { return (hostClockFrozen ? hostFrozenWallUs : hostNanos() / 1000) + hostClockOffsetUs; }
+
+uint32_t millis() { return (uint32_t)(hostNowUs() / 1000); }
+uint32_t micros() { return (uint32_t)hostNowUs(); }
+void delay(uint32_t ms) { hostClockOffsetUs += (uint64_t)ms * 1000; }
+void delayMicroseconds(uint32_t us) { hostClockOffsetUs += us; }
+void hostAdvanceMicros(uint64_t us) { hostClockOffsetUs += us; }
+
+void hostClockSimulated(bool on) {
+  if (on == hostClockFrozen) return;
+  uint64_t now = hostNowUs();
+  hostClockFrozen = on;
+  hostFrozenWallUs = hostNanos() / 1000;
+  hostClockOffsetUs = now - hostFrozenWallUs;  // carries on from `now` either way; wraps harmlessly
+}
+
+int HostSerial::printf(const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  int n = vfprintf(stdout, fmt, args);
+  va_end(args);
+  return n;
+}
@@ -0,0 +1,99 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Minimal Arduino core for native builds: timing, PROGMEM access, the bit
+// helpers the sketch uses and a stdout-backed Serial.
+//
+// delay() does not sleep; it advances the clock that millis()/micros() report,
+// so scripted scenarios can run through seconds of dashboard time instantly.
+// That clock also follows the wall clock unless hostClockSimulated(true) is
+// set. Then only delay() and hostAdvanceMicros() move it, and a script sees
+// the same times however fast the host runs.
+//
+// The firmware's logic headers (layout, units, filters, fixed point, text
+// formatting, RLE, splash packs, boot sequencing) include only the C/C++
+// standard headers. Anything that needs the board lives in main.cpp or
+// behind #ifndef HOST_DISPLAY. That split is what lets test/native run them
+// here unchanged, so keep new pure code that way.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+
+#define HOST_DISPLAY 1
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void hostAdvanceMicros(uint64_t us);  // move the host clock forward without sleeping
+void hostClockSimulated(bool on);     // on: millis()/micros() stop following the wall clock
+uint64_t hostNanos();                 // wall-clock time, unaffected by delay()
+
+inline uint16_t makeWord(uint8_t h, uint8_t l) { return (uint16_t)((h << 8) | l); }
+
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+template <typename T, typename L, typename H>
+inline T constrain(T x, L lo, H hi) { return x < lo ? lo : (x > hi ? hi : x); }
+using std::max;
+using std::min;
+
+class String {
+ public:
+  String(const char* s = "") : str_(s ? s : "") {}
+  String(const std::string& s) : str_(s) {}
+  String(int v) : str_(std::to_string(v)) {}
+  String(unsigned int v) : str_(std::to_string(v)) {}
+  String(long v) : str_(std::to_string(v)) {}
+  String(unsigned long v) : str_(std::to_string(v)) {}
+  const char* c_str() const { return str_.c_str(); }
+  unsigned int length() const { return str_.size(); }
+  String& operator+=(const String& o) { str_ += o.str_; return *this; }
+  friend String operator+(const String& a, const String& b) { return String(a.str_ + b.str_); }
+  bool operator==(const char* s) const { return str_ == s; }
+
+ private:
+  std::string str_;
+};
+
+class HostSerial {
+ public:
+  void begin(unsigned long) {}
+  template <typename T> void print(const T& v) { write(v); }
+  template <typename T> void println(const T& v) { write(v); fputc('\n', stdout); }
+  void println() { fputc('\n', stdout); }
+  int printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+ private:
+  void write(const char* s) { fputs(s, stdout); }
+  void write(const String& s) { fputs(s.c_str(), stdout); }
+  void write(char c) { fputc(c, stdout); }
+  void write(long v) { fprintf(stdout, "%ld", v); }
+  void write(int v) { fprintf(stdout, "%d", v); }
+  void write(unsigned int v) { fprintf(stdout, "%u", v); }
+  void write(unsigned long v) { fprintf(stdout, "%lu", v); }
+  void write(double v) { fprintf(stdout, "%.2f", v); }
+};
+
+extern HostSerial Serial;
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef HOST_EEPROM_H
+#define HOST_EEPROM_H
+
+// RAM-backed EEPROM for native builds; starts erased (0xFF) like a fresh part
+
+#include <stdint.h>
+#include <string.h>
+
+class EEPROMClass {
+ public:
+  EEPROMClass() { memset(data_, 0xFF, sizeof(data_)); }
+  bool begin(size_t) { return true; }
+  uint8_t read(int address) const { return (address >= 0 && address < (int)sizeof(data_)) ? data_[address] : 0; }
+  void write(int address, uint8_t value) {
+    if (address >= 0 && address < (int)sizeof(data_)) data_[address] = value;
+  }
+  bool commit() { return true; }
+
+ private:
+  uint8_t data_[4096];
+};
+
+extern EEPROMClass EEPROM;
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+// Byte sink standing in for the TFT's SPI bus. Raw writes (the RGB666 streams
+// produced by dma_push.h) are fed to whichever display owns the bus and drawn
+// into the current address window.
+
+#include <stdint.h>
+#include <stddef.h>
+
+class TFT_eSPI;
+
+class SPIClass {
+ public:
+  void writeBytes(const uint8_t* data, uint32_t size);
+  void transfer(uint8_t data) { writeBytes(&data, 1); }
+
+  TFT_eSPI* owner = nullptr;
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,625 @@
+#include "TFT_eSPI.h"
+
+SPIClass SPI;
+
+void SPIClass::writeBytes(const uint8_t* data, uint32_t size) {
+  if (owner) owner->streamBytes(data, size);
+}
+
+static uint16_t swap16(uint16_t v) { return (uint16_t)((v >> 8) | (v << 8)); }
+
+static uint32_t readBE32(const uint8_t* p) {
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+// ---------------------------------------------------------------------------
+// Panel
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h) : width_(w), height_(h) {
+  stats = HostDisplayStats();
+  if (w > 0 && h > 0) {
+    panel_.assign((size_t)TFT_WIDTH * TFT_HEIGHT, TFT_BLACK);
+    SPI.owner = this;
+  }
+}
+
+TFT_eSPI::~TFT_eSPI() {
+  if (SPI.owner == this) SPI.owner = nullptr;
+}
+
+void TFT_eSPI::init(uint8_t) {
+  SPI.owner = this;
+  setRotation(0);
+}
+
+void TFT_eSPI::setRotation(uint8_t r) {
+  rotation_ = r & 3;
+  width_ = (rotation_ & 1) ? TFT_HEIGHT : TFT_WIDTH;
+  height_ = (rotation_ & 1) ? TFT_WIDTH : TFT_HEIGHT;
+  costWindow(0);  // MADCTL write, near enough
+}
+
+SPIClass& TFT_eSPI::getSPIinstance() { return SPI; }
+
+// Logical (rotated) coordinates to native panel memory
+uint16_t* TFT_eSPI::panelPixel(int32_t x, int32_t y) {
+  return const_cast<uint16_t*>(static_cast<const TFT_eSPI*>(this)->panelPixel(x, y));
+}
+
+void TFT_eSPI::toNative(int32_t x, int32_t y, int32_t& px, int32_t& py) const {
+  switch (rotation_) {
+    case 1: px = TFT_WIDTH - 1 - y; py = x; break;
+    case 2: px = TFT_WIDTH - 1 - x; py = TFT_HEIGHT - 1 - y; break;
+    case 3: px = y; py = TFT_HEIGHT - 1 - x; break;
+    default: px = x; py = y; break;
+  }
+}
+
+const uint16_t* TFT_eSPI::panelPixel(int32_t x, int32_t y) const {
+  int32_t px, py;
+  toNative(x, y, px, py);
+  return &panel_[(size_t)py * TFT_WIDTH + px];
+}
+
+void TFT_eSPI::writePanel(int32_t x, int32_t y, uint16_t color) {
+  if (x < 0 || y < 0 || x >= width_ || y >= height_) return;
+  *panelPixel(x, y) = color;
+  stats.pixels++;
+}
+
+// What the panel shows: with vertical scrolling on, display line n of the scroll
+// area shows memory line TFA + (n - TFA + VSP - TFA) mod VSA (ILI9488 8.2.30)
+uint16_t TFT_eSPI::pixelAt(int32_t x, int32_t y) const {
+  if (x < 0 || y < 0 || x >= width_ || y >= height_) return TFT_BLACK;
+  int32_t px, py;
+  toNative(x, y, px, py);
+  if (scrolling_ && py >= scrollTfa_ && py < scrollTfa_ + scrollVsa_ && scrollVsa_ > 0) {
+    int32_t offset = (py - scrollTfa_ + scrollVsp_ - scrollTfa_) % scrollVsa_;
+    py = scrollTfa_ + (offset < 0 ? offset + scrollVsa_ : offset);
+  }
+  return panel_[(size_t)py * TFT_WIDTH + px];
+}
+
+bool TFT_eSPI::clip(int32_t& x, int32_t& y, int32_t& w, int32_t& h) const {
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > width_) w = width_ - x;
+  if (y + h > height_) h = height_ - y;
+  return w > 0 && h > 0;
+}
+
+void TFT_eSPI::costWindow(uint64_t pixels) {
+  stats.windows++;
+  stats.spiBytes += HOST_WINDOW_BYTES + pixels * 3;
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  if (x < 0 || y < 0 || x >= width_ || y >= height_) return;
+  costWindow(1);
+  writePanel(x, y, color);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  if (!clip(x, y, w, h)) return;
+  costWindow((uint64_t)w * h);
+  for (int32_t j = y; j < y + h; j++)
+    for (int32_t i = x; i < x + w; i++) writePanel(i, j, color);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) { fillRect(x, y, w, 1, color); }
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) { fillRect(x, y, 1, h, color); }
+
+// Reads frame memory, which scrolling does not move
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) {
+  if (x < 0 || y < 0 || x >= width_ || y >= height_) return TFT_BLACK;
+  return *panelPixel(x, y);
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+  int32_t cx = x, cy = y, cw = w, ch = h;
+  if (!clip(cx, cy, cw, ch)) return;
+  costWindow((uint64_t)cw * ch);
+  for (int32_t j = cy; j < cy + ch; j++) {
+    for (int32_t i = cx; i < cx + cw; i++) {
+      uint16_t c = data[(j - y) * w + (i - x)];
+      writePanel(i, j, swapBytes_ ? c : swap16(c));
+    }
+  }
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t* data, bool bpp8,
+                         const uint16_t* cmap) {
+  int32_t cx = x, cy = y, cw = w, ch = h;
+  if (!clip(cx, cy, cw, ch)) return;
+  costWindow((uint64_t)cw * ch);
+  int32_t stride = bpp8 ? w : (w + 1) / 2;
+  for (int32_t j = cy; j < cy + ch; j++) {
+    for (int32_t i = cx; i < cx + cw; i++) {
+      int32_t sx = i - x;
+      const uint8_t* row = data + (j - y) * stride;
+      uint16_t c;
+      if (bpp8) {
+        uint8_t v = row[sx];
+        c = cmap ? cmap[v] : (uint16_t)(((v & 0xE0) << 8) | ((v & 0x1C) << 6) | ((v & 0x03) << 3));
+      } else {
+        uint8_t v = (sx & 1) ? (row[sx >> 1] & 0x0F) : (row[sx >> 1] >> 4);
+        c = cmap ? cmap[v] : v;
+      }
+      writePanel(i, j, c);
+    }
+  }
+}
+
+uint16_t TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color, uint8_t alpha, uint32_t bg_color) {
+  if (bg_color == 0x00FFFFFF) bg_color = readPixel(x, y);
+  color = alphaBlend(alpha, color, bg_color);
+  drawPixel(x, y, color);
+  return color;
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y + 1, h - 2, color);
+  drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+// Quarter circles at the four corners of a rounded rectangle
+void TFT_eSPI::cornerArcs(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color, bool fill) {
+  int32_t f = 1 - r, ddx = 1, ddy = -2 * r, px = 0, py = r;
+  int32_t left = x + r, right = x + w - r - 1, top = y + r, bottom = y + h - r - 1;
+  while (px < py) {
+    if (f >= 0) { py--; ddy += 2; f += ddy; }
+    px++; ddx += 2; f += ddx;
+    if (fill) {
+      drawFastHLine(left - py, top - px, right - left + 2 * py + 1, color);
+      drawFastHLine(left - px, top - py, right - left + 2 * px + 1, color);
+      drawFastHLine(left - py, bottom + px, right - left + 2 * py + 1, color);
+      drawFastHLine(left - px, bottom + py, right - left + 2 * px + 1, color);
+    } else {
+      drawPixel(right + px, top - py, color);  drawPixel(right + py, top - px, color);
+      drawPixel(right + px, bottom + py, color); drawPixel(right + py, bottom + px, color);
+      drawPixel(left - px, bottom + py, color); drawPixel(left - py, bottom + px, color);
+      drawPixel(left - px, top - py, color);  drawPixel(left - py, top - px, color);
+    }
+  }
+}
+
+void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+  drawFastHLine(x + r, y, w - 2 * r, color);
+  drawFastHLine(x + r, y + h - 1, w - 2 * r, color);
+  drawFastVLine(x, y + r, h - 2 * r, color);
+  drawFastVLine(x + w - 1, y + r, h - 2 * r, color);
+  cornerArcs(x, y, w, h, r, color, false);
+}
+
+void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+  fillRect(x, y + r, w, h - 2 * r, color);
+  cornerArcs(x, y, w, h, r, color, true);
+}
+
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) {
+  int32_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+  int32_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+  int32_t err = dx + dy;
+  while (true) {
+    drawPixel(x0, y0, color);
+    if (x0 == x1 && y0 == y1) break;
+    int32_t e2 = 2 * err;
+    if (e2 >= dy) { err += dy; x0 += sx; }
+    if (e2 <= dx) { err += dx; y0 += sy; }
+  }
+}
+
+void TFT_eSPI::drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+  int32_t x = r, y = 0, err = 1 - r;
+  while (x >= y) {
+    drawPixel(x0 + x, y0 + y, color); drawPixel(x0 - x, y0 + y, color);
+    drawPixel(x0 + x, y0 - y, color); drawPixel(x0 - x, y0 - y, color);
+    drawPixel(x0 + y, y0 + x, color); drawPixel(x0 - y, y0 + x, color);
+    drawPixel(x0 + y, y0 - x, color); drawPixel(x0 - y, y0 - x, color);
+    y++;
+    if (err < 0) { err += 2 * y + 1; } else { x--; err += 2 * (y - x) + 1; }
+  }
+}
+
+void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+  for (int32_t dy = -r; dy <= r; dy++) {
+    int32_t dx = (int32_t)sqrtf((float)(r * r - dy * dy));
+    drawFastHLine(x0 - dx, y0 + dy, 2 * dx + 1, color);
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Address-window streaming
+
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+  winX_ = x; winY_ = y; winW_ = w; winH_ = h; winPos_ = 0;
+  partialLen_ = 0;
+  stats.windows++;
+  stats.spiBytes += HOST_WINDOW_BYTES;
+}
+
+void TFT_eSPI::streamPixel(uint16_t color) {
+  if (winW_ <= 0 || winH_ <= 0) return;
+  writePanel(winX_ + winPos_ % winW_, winY_ + winPos_ / winW_, color);
+  if (++winPos_ >= winW_ * winH_) winPos_ = 0;  // the panel wraps back to the window start
+}
+
+void TFT_eSPI::pushBlock(uint16_t color, uint32_t len) {
+  stats.spiBytes += (uint64_t)len * 3;
+  while (len--) streamPixel(color);
+}
+
+void TFT_eSPI::pushPixels(const void* data, uint32_t len) {
+  const uint16_t* p = (const uint16_t*)data;
+  stats.spiBytes += (uint64_t)len * 3;
+  while (len--) {
+    uint16_t c = *p++;
+    streamPixel(swapBytes_ ? c : swap16(c));
+  }
+}
+
+// One 3-bit pixel, RGB from bit 2 down to bit 0
+static uint16_t color3bit(uint8_t v) {
+  return (uint16_t)(((v & 4) ? 0xF800 : 0) | ((v & 2) ? 0x07E0 : 0) | ((v & 1) ? 0x001F : 0));
+}
+
+void TFT_eSPI::streamBytes(const uint8_t* data, uint32_t size) {
+  stats.spiBytes += size;
+  if ((pixelFormat_ & 0x07) == 0x01) {
+    while (size--) {
+      streamPixel(color3bit(*data >> 3));
+      streamPixel(color3bit(*data++));
+    }
+    return;
+  }
+  while (size--) {
+    partial_[partialLen_++] = *data++;
+    if (partialLen_ == 3) {
+      streamPixel(color565(partial_[0], partial_[1], partial_[2]));
+      partialLen_ = 0;
+    }
+  }
+}
+
+void TFT_eSPI::pushPixelsDMA(uint16_t* image, uint32_t len) {
+  if (swapBytes_) {
+    for (uint32_t i = 0; i < len; i++) image[i] = swap16(image[i]);
+  }
+  streamBytes((const uint8_t*)image, len * 2);
+}
+
+void TFT_eSPI::writecommand(uint8_t c) {
+  command_ = c;
+  commandArgLen_ = 0;
+  stats.spiBytes++;
+  if (c == 0x13) scrolling_ = false;  // NORON leaves vertical scroll mode
+}
+
+// Commands the host panel acts on once their arguments are complete:
+// VSCRDEF (0x33), VSCRSADD (0x37) and COLMOD (0x3A)
+void TFT_eSPI::writedata(uint8_t d) {
+  if (commandArgLen_ < sizeof(commandArgs_)) commandArgs_[commandArgLen_++] = d;
+  stats.spiBytes++;
+  const uint8_t* a = commandArgs_;
+  if (command_ == 0x33 && commandArgLen_ == 6) {
+    scrollTfa_ = (a[0] << 8) | a[1];
+    scrollVsa_ = (a[2] << 8) | a[3];
+    scrollBfa_ = (a[4] << 8) | a[5];
+  } else if (command_ == 0x37 && commandArgLen_ == 2) {
+    scrollVsp_ = (a[0] << 8) | a[1];
+    scrolling_ = true;
+  } else if (command_ == 0x3A && commandArgLen_ == 1) {
+    pixelFormat_ = a[0];
+  }
+}
+
+uint16_t TFT_eSPI::alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc) {
+  // Same arithmetic as TFT_eSPI so palette tricks that rely on it behave identically
+  uint32_t rxb = bgc & 0xF81F;
+  rxb += ((fgc & 0xF81F) - rxb) * (alpha >> 2) >> 6;
+  uint32_t xgx = bgc & 0x07E0;
+  xgx += ((fgc & 0x07E0) - xgx) * alpha >> 8;
+  return (rxb & 0xF81F) | (xgx & 0x07E0);
+}
+
+bool TFT_eSPI::savePPM(const char* path) const {
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  fprintf(f, "P6\n%d %d\n255\n", width_, height_);
+  for (int32_t y = 0; y < height_; y++) {
+    for (int32_t x = 0; x < width_; x++) {
+      uint16_t c = pixelAt(x, y);
+      uint8_t rgb[3] = { (uint8_t)(((c >> 11) & 0x1F) * 255 / 31), (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+                         (uint8_t)((c & 0x1F) * 255 / 31) };
+      fwrite(rgb, 1, 3, f);
+    }
+  }
+  return fclose(f) == 0;
+}
+
+// ---------------------------------------------------------------------------
+// Smooth fonts (Processing .vlw arrays, as produced for TFT_eSPI)
+
+void TFT_eSPI::loadFont(const uint8_t array[]) {
+  unloadFont();
+  uint32_t count = readBE32(array);
+  yAdvance_ = (uint16_t)readBE32(array + 8);
+  spaceWidth_ = yAdvance_ / 4;
+  maxAscent_ = (uint16_t)readBE32(array + 16);
+  maxDescent_ = (uint16_t)readBE32(array + 20);
+
+  const uint8_t* metrics = array + 24;
+  const uint8_t* bitmap = metrics + count * 28;
+  glyphs_.reserve(count);
+  for (uint32_t i = 0; i < count; i++, metrics += 28) {
+    Glyph g;
+    g.code = (uint16_t)readBE32(metrics);
+    g.height = (uint8_t)readBE32(metrics + 4);
+    g.width = (uint8_t)readBE32(metrics + 8);
+    g.xAdvance = (uint8_t)readBE32(metrics + 12);
+    g.dY = (int16_t)readBE32(metrics + 16);
+    g.dX = (int8_t)readBE32(metrics + 20);
+    g.bitmap = bitmap;
+    bitmap += g.width * g.height;
+    if (g.code == ' ') spaceWidth_ = g.xAdvance;
+    if (g.code > 0x20 && g.code < 0xA0 && g.code != 0x7F) {
+      if (g.dY > (int16_t)maxAscent_) maxAscent_ = g.dY;
+      if (g.height - g.dY > (int16_t)maxDescent_) maxDescent_ = g.height - g.dY;
+    }
+    glyphs_.push_back(g);
+  }
+  yAdvance_ = maxAscent_ + maxDescent_;
+  fontLoaded_ = true;
+}
+
+void TFT_eSPI::unloadFont() {
+  glyphs_.clear();
+  fontLoaded_ = false;
+}
+
+void TFT_eSPI::setTextColor(uint16_t fg, uint16_t bg, bool fillbg) {
+  textColor_ = fg;
+  textBgColor_ = bg;
+  textFillBg_ = fillbg;
+}
+
+const TFT_eSPI::Glyph* TFT_eSPI::findGlyph(uint16_t code) const {
+  for (const Glyph& g : glyphs_) {
+    if (g.code == code) return &g;
+  }
+  return nullptr;
+}
+
+int16_t TFT_eSPI::fontHeight() { return fontLoaded_ ? yAdvance_ : 8; }
+
+int16_t TFT_eSPI::textWidth(const char* string) {
+  if (!fontLoaded_) return 6 * strlen(string);
+  int16_t width = 0;
+  for (const char* c = string; *c; c++) {
+    const Glyph* g = findGlyph((uint8_t)*c);
+    if (!g) {
+      width += spaceWidth_ + 1;
+    } else if (c[1] == 0) {
+      width += (g->xAdvance > g->dX + g->width) ? g->xAdvance : g->dX + g->width;
+    } else {
+      width += g->xAdvance;
+    }
+  }
+  return width;
+}
+
+// Solid runs go out as horizontal lines and edge pixels one at a time, as
+// TFT_eSPI does, so the traffic figures match the real library's pattern.
+void TFT_eSPI::drawGlyph(const Glyph* g, int32_t x, int32_t y) {
+  if (textFillBg_) fillRect(x, y, g->xAdvance, yAdvance_, textBgColor_);
+  int32_t gx = x + g->dX;
+  int32_t gy = y + maxAscent_ - g->dY;
+  const uint8_t* p = g->bitmap;
+  for (int32_t row = 0; row < g->height; row++) {
+    int32_t runStart = -1;
+    for (int32_t col = 0; col <= g->width; col++) {
+      uint8_t alpha = (col < g->width) ? p[col] : 0;
+      if (alpha == 0xFF) {
+        if (runStart < 0) runStart = col;
+        continue;
+      }
+      if (runStart >= 0) {
+        drawFastHLine(gx + runStart, gy + row, col - runStart, textColor_);
+        runStart = -1;
+      }
+      if (alpha) drawPixel(gx + col, gy + row, textColor_, alpha, textFillBg_ ? textBgColor_ : 0x00FFFFFF);
+    }
+    p += g->width;
+  }
+}
+
+int16_t TFT_eSPI::drawString(const char* string, int32_t x, int32_t y) {
+  int16_t w = textWidth(string);
+  int16_t h = fontHeight();
+  switch (textDatum_) {
+    case TC_DATUM: x -= w / 2; break;
+    case TR_DATUM: x -= w; break;
+    case ML_DATUM: y -= h / 2; break;
+    case MC_DATUM: x -= w / 2; y -= h / 2; break;
+    case MR_DATUM: x -= w; y -= h / 2; break;
+    case BL_DATUM: y -= h; break;
+    case BC_DATUM: x -= w / 2; y -= h; break;
+    case BR_DATUM: x -= w; y -= h; break;
+    case L_BASELINE: y -= maxAscent_; break;
+    case C_BASELINE: x -= w / 2; y -= maxAscent_; break;
+    case R_BASELINE: x -= w; y -= maxAscent_; break;
+    default: break;
+  }
+  if (!fontLoaded_) return w;
+
+  for (const char* c = string; *c; c++) {
+    const Glyph* g = findGlyph((uint8_t)*c);
+    if (g) {
+      drawGlyph(g, x, y);
+      x += g->xAdvance;
+    } else {
+      if (textFillBg_) fillRect(x, y, spaceWidth_ + 1, yAdvance_, textBgColor_);
+      x += spaceWidth_ + 1;
+    }
+  }
+  return w;
+}
+
+int16_t TFT_eSPI::drawNumber(long value, int32_t x, int32_t y) {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%ld", value);
+  return drawString(buf, x, y);
+}
+
+int16_t TFT_eSPI::drawFloat(float value, uint8_t dp, int32_t x, int32_t y) {
+  char buf[24];
+  snprintf(buf, sizeof(buf), "%.*f", dp, (double)value);
+  return drawString(buf, x, y);
+}
+
+// ---------------------------------------------------------------------------
+// Sprites
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI* tft) : TFT_eSPI(0, 0), tft_(tft) {
+  createPalette();
+}
+
+TFT_eSprite::~TFT_eSprite() { deleteSprite(); }
+
+int32_t TFT_eSprite::stride() const {
+  switch (bpp_) {
+    case 16: return width_ * 2;
+    case 8: return width_;
+    case 4: return (width_ + 1) / 2;
+    default: return (width_ + 7) / 8;
+  }
+}
+
+void* TFT_eSprite::createSprite(int16_t width, int16_t height, uint8_t) {
+  if (created()) return getPointer();
+  width_ = width;
+  height_ = height;
+  buffer_.assign((size_t)stride() * height + 1, 0);
+  return getPointer();
+}
+
+void TFT_eSprite::deleteSprite() {
+  buffer_.clear();
+  buffer_.shrink_to_fit();
+}
+
+void* TFT_eSprite::setColorDepth(int8_t bpp) {
+  if (created()) deleteSprite();
+  bpp_ = (bpp == 16 || bpp == 8 || bpp == 4) ? bpp : 1;
+  return nullptr;
+}
+
+void TFT_eSprite::createPalette(const uint16_t* palette, uint8_t colors) {
+  static const uint16_t defaults[16] = { TFT_BLACK, TFT_BROWN, TFT_RED, TFT_ORANGE, TFT_YELLOW, TFT_GREEN,
+                                         TFT_BLUE, TFT_PURPLE, TFT_DARKGREY, TFT_WHITE, TFT_CYAN, TFT_MAGENTA,
+                                         TFT_MAROON, TFT_DARKGREEN, TFT_NAVY, TFT_PINK };
+  for (uint8_t i = 0; i < 16; i++) palette_[i] = (palette && i < colors) ? palette[i] : defaults[i];
+}
+
+void TFT_eSprite::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  if (!created() || x < 0 || y < 0 || x >= width_ || y >= height_) return;
+  uint8_t* row = buffer_.data() + y * stride();
+  switch (bpp_) {
+    case 16: {
+      uint16_t c = swap16((uint16_t)color);  // stored byte-swapped, ready for the wire
+      memcpy(row + x * 2, &c, 2);
+      break;
+    }
+    case 8:
+      row[x] = (uint8_t)(((color & 0xE000) >> 8) | ((color & 0x0700) >> 6) | ((color & 0x0018) >> 3));
+      break;
+    case 4:
+      if (x & 1) row[x >> 1] = (row[x >> 1] & 0xF0) | (color & 0x0F);
+      else row[x >> 1] = (row[x >> 1] & 0x0F) | ((color & 0x0F) << 4);
+      break;
+    default:
+      if (color) row[x >> 3] |= 0x80 >> (x & 7);
+      else row[x >> 3] &= ~(0x80 >> (x & 7));
+      break;
+  }
+}
+
+void TFT_eSprite::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  if (!clip(x, y, w, h)) return;
+  for (int32_t j = y; j < y + h; j++)
+    for (int32_t i = x; i < x + w; i++) drawPixel(i, j, color);
+}
+
+uint16_t TFT_eSprite::readPixel(int32_t x, int32_t y) {
+  if (!created() || x < 0 || y < 0 || x >= width_ || y >= height_) return 0;
+  const uint8_t* row = buffer_.data() + y * stride();
+  switch (bpp_) {
+    case 16: {
+      uint16_t c;
+      memcpy(&c, row + x * 2, 2);
+      return swap16(c);
+    }
+    case 8: {
+      uint8_t v = row[x];
+      return ((v & 0xE0) << 8) | ((v & 0x1C) << 6) | ((v & 0x03) << 3);
+    }
+    case 4:
+      return palette_[(x & 1) ? (row[x >> 1] & 0x0F) : (row[x >> 1] >> 4)];
+    default:
+      return (row[x >> 3] & (0x80 >> (x & 7))) ? TFT_WHITE : TFT_BLACK;
+  }
+}
+
+void TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+  for (int32_t j = 0; j < h; j++) {
+    for (int32_t i = 0; i < w; i++) {
+      uint16_t c = data[j * w + i];
+      drawPixel(x + i, y + j, swapBytes_ ? c : swap16(c));
+    }
+  }
+}
+
+void TFT_eSprite::push(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh,
+                       bool useTransparent, uint16_t transparent) {
+  if (!created() || !tft_) return;
+  std::vector<uint16_t> pixels((size_t)sw * sh);
+  for (int32_t j = 0; j < sh; j++)
+    for (int32_t i = 0; i < sw; i++) pixels[j * sw + i] = readPixel(sx + i, sy + j);
+
+  if (!useTransparent) {
+    bool swap = tft_->getSwapBytes();
+    tft_->setSwapBytes(true);  // readPixel() already gave native RGB565
+    tft_->pushImage(tx, ty, sw, sh, pixels.data());
+    tft_->setSwapBytes(swap);
+    return;
+  }
+  // The library sends each opaque run as its own window
+  for (int32_t j = 0; j < sh; j++) {
+    int32_t i = 0;
+    while (i < sw) {
+      while (i < sw && pixels[j * sw + i] == transparent) i++;
+      int32_t start = i;
+      while (i < sw && pixels[j * sw + i] != transparent) i++;
+      if (i > start) {
+        bool swap = tft_->getSwapBytes();
+        tft_->setSwapBytes(true);
+        tft_->pushImage(tx + start, ty + j, i - start, 1, &pixels[j * sw + start]);
+        tft_->setSwapBytes(swap);
+      }
+    }
+  }
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) { push(x, y, 0, 0, width_, height_, false, 0); }
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y, uint16_t transparent) {
+  push(x, y, 0, 0, width_, height_, true, transparent);
+}
+
+bool TFT_eSprite::pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh) {
+  if (sx < 0 || sy < 0 || sw <= 0 || sh <= 0 || sx + sw > width_ || sy + sh > height_) return false;
+  push(tx, ty, sx, sy, sw, sh, false, 0);
+  return true;
+}
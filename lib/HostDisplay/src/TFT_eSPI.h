@@ -0,0 +1,248 @@
+#ifndef HOST_TFT_ESPI_H
+#define HOST_TFT_ESPI_H
+
+// Headless stand-in for TFT_eSPI on native builds.
+//
+// Covers the subset the dashboard uses - rectangles, lines, smooth (vlw)
+// fonts, 16/8/4/1 bpp sprites, address-window streaming, the DMA calls and
+// hardware vertical scrolling (VSCRDEF/VSCRSADD) - and renders into an in-memory ILI9488 (320x480, rotated like the real
+// panel). Every write is also costed as the bytes an ILI9488 on 4-wire SPI
+// would receive: 3 bytes per pixel plus 11 bytes per address window
+// (CASET + RASET + RAMWR), so optimisations can be compared by traffic as
+// well as by time. savePPM() dumps what the panel would show.
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <vector>
+
+#ifndef TFT_WIDTH
+#define TFT_WIDTH 320
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 480
+#endif
+
+// Transfers complete synchronously, but the DMA entry points exist so the
+// dma_push.h path is the one being exercised.
+#define ESP32_DMA
+
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_DARKCYAN    0x03EF
+#define TFT_MAROON      0x7800
+#define TFT_PURPLE      0x780F
+#define TFT_OLIVE       0x7BE0
+#define TFT_LIGHTGREY   0xD69A
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+#define TFT_GREENYELLOW 0xB7E0
+#define TFT_PINK        0xFE19
+#define TFT_BROWN       0x9A60
+#define TFT_GOLD        0xFEA0
+#define TFT_SILVER      0xC618
+#define TFT_SKYBLUE     0x867D
+#define TFT_VIOLET      0x915C
+#define TFT_TRANSPARENT 0x0120
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define CL_DATUM 3
+#define MC_DATUM 4
+#define CC_DATUM 4
+#define MR_DATUM 5
+#define CR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+#define L_BASELINE 9
+#define C_BASELINE 10
+#define R_BASELINE 11
+
+#define HOST_WINDOW_BYTES 11  // CASET (1+4) + RASET (1+4) + RAMWR (1)
+
+struct HostDisplayStats {
+  uint64_t pixels;    // pixels written to panel memory
+  uint64_t spiBytes;  // bytes an ILI9488 on SPI would have received
+  uint32_t windows;   // address windows opened
+};
+
+class TFT_eSPI {
+ public:
+  TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+  virtual ~TFT_eSPI();
+
+  void init(uint8_t tc = 0);
+  void begin(uint8_t tc = 0) { init(tc); }
+  void setRotation(uint8_t r);
+  uint8_t getRotation() const { return rotation_; }
+  int16_t width() const { return width_; }
+  int16_t height() const { return height_; }
+
+  virtual void drawPixel(int32_t x, int32_t y, uint32_t color);
+  virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  virtual void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+  virtual void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+  virtual uint16_t readPixel(int32_t x, int32_t y);
+  virtual void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t* data, bool bpp8 = true,
+                 const uint16_t* cmap = nullptr);
+
+  uint16_t drawPixel(int32_t x, int32_t y, uint32_t color, uint8_t alpha, uint32_t bg_color = 0x00FFFFFF);
+  void fillScreen(uint32_t color) { fillRect(0, 0, width_, height_, color); }
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+  void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+  void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+  void drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color);
+  void fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color);
+
+  // Streaming into an address window
+  void startWrite() {}
+  void endWrite() {}
+  void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+  void setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1) { setAddrWindow(x0, y0, x1 - x0 + 1, y1 - y0 + 1); }
+  void pushColor(uint16_t color) { pushBlock(color, 1); }
+  void pushColor(uint16_t color, uint32_t len) { pushBlock(color, len); }
+  void pushBlock(uint16_t color, uint32_t len);
+  void pushPixels(const void* data, uint32_t len);
+  void writecommand(uint8_t c);
+  void writedata(uint8_t d);
+  void setSwapBytes(bool swap) { swapBytes_ = swap; }
+  bool getSwapBytes() const { return swapBytes_; }
+  static SPIClass& getSPIinstance();
+
+  bool initDMA(bool ctrl_cs = false) { (void)ctrl_cs; return true; }
+  void deInitDMA() {}
+  bool dmaBusy() { return false; }
+  void dmaWait() {}
+  void pushPixelsDMA(uint16_t* image, uint32_t len);
+
+  uint16_t alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc);
+  uint16_t color565(uint8_t r, uint8_t g, uint8_t b) { return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3); }
+
+  // Text: smooth fonts are rendered; without one loaded text is only measured
+  void loadFont(const uint8_t array[]);
+  void unloadFont();
+  void setTextColor(uint16_t fg) { setTextColor(fg, fg, false); }
+  void setTextColor(uint16_t fg, uint16_t bg, bool fillbg = false);
+  void setTextDatum(uint8_t datum) { textDatum_ = datum; }
+  uint8_t getTextDatum() const { return textDatum_; }
+  void setTextSize(uint8_t) {}
+  void setTextFont(uint8_t) {}
+  int16_t drawString(const char* string, int32_t x, int32_t y);
+  int16_t drawString(const String& string, int32_t x, int32_t y) { return drawString(string.c_str(), x, y); }
+  int16_t drawNumber(long value, int32_t x, int32_t y);
+  int16_t drawFloat(float value, uint8_t dp, int32_t x, int32_t y);
+  int16_t textWidth(const char* string);
+  int16_t textWidth(const String& string) { return textWidth(string.c_str()); }
+  int16_t fontHeight();
+
+  // Host-only
+  HostDisplayStats stats;
+  void resetStats() { stats = HostDisplayStats(); }
+  uint16_t pixelAt(int32_t x, int32_t y) const;  // what the panel shows at (x, y), after scrolling
+  bool savePPM(const char* path) const;
+
+  // Raw pixel bytes arriving over SPI (from getSPIinstance().writeBytes / DMA):
+  // RGB666, or two 3-bit pixels per byte after COLMOD 0x01
+  void streamBytes(const uint8_t* data, uint32_t size);
+
+ protected:
+  struct Glyph {
+    uint16_t code;
+    uint8_t height, width, xAdvance;
+    int16_t dY;
+    int8_t dX;
+    const uint8_t* bitmap;
+  };
+
+  bool clip(int32_t& x, int32_t& y, int32_t& w, int32_t& h) const;
+  void costWindow(uint64_t pixels);
+  void writePanel(int32_t x, int32_t y, uint16_t color);  // logical coords, no costing
+  const Glyph* findGlyph(uint16_t code) const;
+  void drawGlyph(const Glyph* glyph, int32_t x, int32_t y);
+  void cornerArcs(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color, bool fill);
+
+  int16_t width_, height_;
+  uint8_t rotation_ = 0;
+  bool swapBytes_ = false;
+
+  // Font state
+  std::vector<Glyph> glyphs_;
+  bool fontLoaded_ = false;
+  uint16_t yAdvance_ = 0, spaceWidth_ = 0, maxAscent_ = 0, maxDescent_ = 0;
+  uint16_t textColor_ = TFT_WHITE, textBgColor_ = TFT_BLACK;
+  bool textFillBg_ = false;
+  uint8_t textDatum_ = TL_DATUM;
+
+ private:
+  // Panel memory in native portrait orientation
+  std::vector<uint16_t> panel_;
+  int32_t winX_ = 0, winY_ = 0, winW_ = 0, winH_ = 0, winPos_ = 0;
+  uint8_t partial_[3];
+  uint8_t partialLen_ = 0;
+  uint8_t command_ = 0;
+  uint8_t commandArgs_[8];
+  uint8_t commandArgLen_ = 0;
+  // Vertical scrolling, in native panel lines
+  int32_t scrollTfa_ = 0, scrollVsa_ = TFT_HEIGHT, scrollBfa_ = 0, scrollVsp_ = 0;
+  bool scrolling_ = false;
+  uint8_t pixelFormat_ = 0x66;  // COLMOD (0x3A)
+
+  void streamPixel(uint16_t color);
+  void toNative(int32_t x, int32_t y, int32_t& px, int32_t& py) const;
+  uint16_t* panelPixel(int32_t x, int32_t y);
+  const uint16_t* panelPixel(int32_t x, int32_t y) const;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+ public:
+  explicit TFT_eSprite(TFT_eSPI* tft);
+  ~TFT_eSprite() override;
+
+  void* createSprite(int16_t width, int16_t height, uint8_t frames = 1);
+  void deleteSprite();
+  bool created() const { return !buffer_.empty(); }
+  void* getPointer() { return buffer_.empty() ? nullptr : buffer_.data(); }
+  void* setColorDepth(int8_t bpp);
+  int8_t getColorDepth() const { return bpp_; }
+
+  void createPalette(const uint16_t* palette = nullptr, uint8_t colors = 16);
+  void setPaletteColor(uint8_t index, uint16_t color) { palette_[index & 0x0F] = color; }
+  uint16_t getPaletteColor(uint8_t index) const { return palette_[index & 0x0F]; }
+
+  void fillSprite(uint32_t color) { fillRect(0, 0, width_, height_, color); }
+  void pushSprite(int32_t x, int32_t y);
+  void pushSprite(int32_t x, int32_t y, uint16_t transparent);
+  bool pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
+
+  void drawPixel(int32_t x, int32_t y, uint32_t color) override;
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override;
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) override { fillRect(x, y, w, 1, color); }
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) override { fillRect(x, y, 1, h, color); }
+  uint16_t readPixel(int32_t x, int32_t y) override;
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) override;
+  using TFT_eSPI::drawPixel;
+
+ private:
+  void push(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh, bool useTransparent,
+            uint16_t transparent);
+  int32_t stride() const;
+
+  TFT_eSPI* tft_;
+  int8_t bpp_ = 16;
+  std::vector<uint8_t> buffer_;
+  uint16_t palette_[16];
+};
+
+#endif
@@ -5,7 +5,8 @@
 #define DATA_LEN 300
 
 static uint8_t buffer[DATA_LEN];
-void requestData(uint16_t timeout = 20);
+// Returns true when a complete realtime frame was read into the buffer
+bool requestData(uint16_t timeout = 20);
 
 bool getBit(uint16_t address, uint8_t bit);
 uint8_t getByte(uint16_t address);
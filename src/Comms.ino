@@ -1,7 +1,7 @@
 #include "Arduino.h"
 #include "Comms.h"
 
-void requestData(uint16_t timeout)
+bool requestData(uint16_t timeout)
 {
   Serial1.setTimeout(timeout);
 
@@ -22,12 +22,13 @@ void requestData(uint16_t timeout)
     Serial1.read(); // 0x32
     uint8_t dataLen = Serial1.read();
     if (dataLen <= DATA_LEN) {
-      Serial1.readBytes(buffer, dataLen);
+      return Serial1.readBytes(buffer, dataLen) == dataLen;
     } else {
       // Serial.println("Data overflow: Invalid data length");
       // Serial.println(dataLen);
     }
   }
+  return false;
 }
 
 bool getBit(uint16_t address, uint8_t bit) {
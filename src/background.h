@@ -0,0 +1,131 @@
+#ifndef BACKGROUND_H
+#define BACKGROUND_H
+
+// Pre-rendered static chrome for a page.
+//
+// A background is a solid colour plus a handful of tiles (labels, frames)
+// that never change while the page is up. Each tile is rendered once through
+// a temporary 16-bit sprite - smooth font and all - and kept RLE-compressed in
+// RAM; blitting the page is one fillScreen() and a DMA push per tile, decoded
+// straight into the line buffers. Dynamic widgets then only ever draw their
+// value regions and never have to repaint label pixels. Tiles are pushed
+// through the DMA line buffers, so initDmaPush() must have succeeded.
+
+#include <TFT_eSPI.h>
+#include "dma_push.h"
+#include "rle.h"
+
+#ifndef BACKGROUND_MAX_TILES
+#define BACKGROUND_MAX_TILES 16
+#endif
+
+struct BackgroundTile {
+  int16_t x, y, w, h;
+  uint16_t* rle;
+  uint32_t words;
+};
+
+struct Background {
+  uint16_t color;
+  uint8_t count;
+  BackgroundTile tiles[BACKGROUND_MAX_TILES];
+};
+
+void backgroundClear(Background& bg, uint16_t color) {
+  for (uint8_t i = 0; i < bg.count; i++) free(bg.tiles[i].rle);
+  bg.count = 0;
+  bg.color = color;
+}
+
+// Bytes of RAM held by the compressed tiles
+uint32_t backgroundBytes(const Background& bg) {
+  uint32_t bytes = 0;
+  for (uint8_t i = 0; i < bg.count; i++) bytes += bg.tiles[i].words * 2;
+  return bytes;
+}
+
+// Compress the (0, 0, w, h) corner of a 16-bit sprite into a new tile at (x, y).
+// The tile must lie fully on screen, as pushWindowDMA() needs.
+bool backgroundAddSprite(Background& bg, TFT_eSprite& sprite, int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (bg.count >= BACKGROUND_MAX_TILES) return false;
+  if (x < 0 || y < 0 || x + w > display.width() || y + h > display.height()) return false;
+  const uint16_t* pixels = (const uint16_t*)sprite.getPointer();
+  if (!pixels || sprite.getColorDepth() != 16) return false;
+
+  // Rows are compressed back to back so a tile decodes as one stream
+  int32_t stride = sprite.width();
+  uint32_t words = 0;
+  for (int16_t row = 0; row < h; row++) words += rleEncode16(pixels + row * stride, w, nullptr, 0);
+  uint16_t* rle = (uint16_t*)malloc(words * 2);
+  if (!rle) return false;
+  uint32_t at = 0;
+  for (int16_t row = 0; row < h; row++) at += rleEncode16(pixels + row * stride, w, rle + at, words - at);
+
+  bg.tiles[bg.count++] = { x, y, w, h, rle, words };
+  return true;
+}
+
+// Render `text` with `font` as a tile, positioned like display.drawString(text, x, y) with `datum`,
+// then moved in from any edge it would hang over
+bool backgroundAddText(Background& bg, const char* text, int16_t x, int16_t y, uint8_t datum, uint16_t color,
+                       const uint8_t* font) {
+  TFT_eSprite tile(&display);
+  tile.setColorDepth(16);
+  tile.loadFont(font);
+  int16_t w = tile.textWidth(text);
+  int16_t h = tile.fontHeight();
+  if (datum == TC_DATUM) x -= w / 2;
+  else if (datum == TR_DATUM) x -= w;
+  x = constrain(x, 0, display.width() - w);
+  y = constrain(y, 0, display.height() - h);
+
+  bool added = false;
+  if (w > 0 && w <= display.width() && tile.createSprite(w, h)) {
+    tile.fillSprite(bg.color);
+    tile.setTextColor(color, bg.color, true);
+    tile.setTextDatum(TL_DATUM);
+    tile.drawString(text, 0, 0);
+    added = backgroundAddSprite(bg, tile, x, y, w, h);
+  }
+  tile.unloadFont();
+  tile.deleteSprite();
+  return added;
+}
+
+static void dmaFillFromRle(uint8_t* dst, int16_t line, int16_t lines, int16_t width, void* ctx) {
+  (void)line;
+  rleDecodeRgb666(*(RleReader*)ctx, dst, (int32_t)lines * width);
+}
+
+void backgroundBlitTile(const Background& bg, uint8_t index) {
+  const BackgroundTile& t = bg.tiles[index];
+  if (!dmaPushBuf[0]) return;
+  RleReader reader;
+  rleBegin(reader, t.rle);
+  pushWindowDMA(t.x, t.y, t.w, t.h, dmaFillFromRle, &reader);
+}
+
+// Push every tile, for a screen that already shows the background colour
+void backgroundBlitTiles(const Background& bg) {
+  for (uint8_t i = 0; i < bg.count; i++) backgroundBlitTile(bg, i);
+  dmaPushFlush();
+}
+
+// Repaint the whole page background
+void backgroundBlit(const Background& bg) {
+  dmaPushFlush();
+  display.fillScreen(bg.color);
+  backgroundBlitTiles(bg);
+}
+
+// Paint the tiles out with the background colour, leaving the screen as if only
+// fillScreen(color) had been done - much cheaper than a full clear on page switches
+void backgroundErase(const Background& bg) {
+  dmaPushFlush();
+  for (uint8_t i = 0; i < bg.count; i++) {
+    const BackgroundTile& t = bg.tiles[i];
+    display.fillRect(t.x, t.y, t.w, t.h, bg.color);
+  }
+}
+
+#endif
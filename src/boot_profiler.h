@@ -0,0 +1,123 @@
+#ifndef BOOT_PROFILER_H
+#define BOOT_PROFILER_H
+
+// Boot timeline: when each setup() stage started and how long it ran, in
+// microseconds since the timer started.
+//
+// A BootStageScope at the top of a block charges the time spent in it to one
+// stage. A stage entered more than once, like the ECU probes the boot
+// sequencer slips in between its steps, adds up its time and counts its
+// calls. On the device the timeline sits in RTC memory, so it survives a
+// watchdog or brownout reset: the next boot keeps a copy, and a boot that
+// never finished still shows how far it got. bootTimelineFormat() renders
+// it for the /boot page and the serial console.
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+enum BootStageId {
+  BOOT_STAGE_DISPLAY,    // display.init(), rotation, DMA buffers
+  BOOT_STAGE_EEPROM,     // EEPROM.begin() and the defaults
+  BOOT_STAGE_SETTINGS,   // units and layout from EEPROM and LittleFS
+  BOOT_STAGE_ECU_PROBE,  // every realtime request made during boot
+  BOOT_STAGE_SPLASH_INIT,
+  BOOT_STAGE_SPLASH,     // drawing the splash
+  BOOT_STAGE_SEQUENCER,  // splash on screen, the three below run inside it
+  BOOT_STAGE_DASHBOARD,  // background and sprites
+  BOOT_STAGE_WIFI,
+  BOOT_STAGE_SERVER,
+  BOOT_STAGE_START_UP,   // startUpDisplay(), sweep included
+  BOOT_STAGE_COUNT
+};
+
+const char* const bootStageNames[BOOT_STAGE_COUNT] = {
+  "display.init", "EEPROM.begin", "settings", "ecuProbe", "initSplashManager", "splash",
+  "bootSequencer", "dashboard", "WiFi.softAP", "server.begin", "startUpDisplay"
+};
+
+// Changes whenever the stage list does, so a timeline left by other firmware is ignored
+#define BOOT_TIMELINE_MAGIC (0x42540000 | BOOT_STAGE_COUNT)
+
+struct BootStageTime {
+  uint32_t startUs;  // first entry
+  uint32_t us;       // all entries together
+  uint16_t calls;    // 0 = never reached
+};
+
+struct BootTimeline {
+  uint32_t magic;
+  uint32_t doneUs;  // setup() finished; 0 if it never did
+  BootStageTime stages[BOOT_STAGE_COUNT];
+};
+
+static inline bool bootTimelineValid(const BootTimeline& t) { return t.magic == BOOT_TIMELINE_MAGIC; }
+
+static inline void bootTimelineBegin(BootTimeline& t) {
+  memset(&t, 0, sizeof(t));
+  t.magic = BOOT_TIMELINE_MAGIC;
+}
+
+static inline void bootTimelineRecord(BootTimeline& t, BootStageId id, uint32_t startUs, uint32_t endUs) {
+  BootStageTime& s = t.stages[id];
+  if (!s.calls) s.startUs = startUs;
+  s.us += endUs - startUs;
+  s.calls++;
+}
+
+static inline void bootTimelineEnd(BootTimeline& t, uint32_t nowUs) { t.doneUs = nowUs; }
+
+// printf onto the end of `buf`, stopping at `len`
+static inline void bootAppend(char* buf, size_t len, size_t& used, const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(buf + used, len - used, fmt, args);
+  va_end(args);
+  if (n > 0) used = (used + n < len) ? used + n : len - 1;
+}
+
+// One line per stage reached, in the order they started, then the total.
+// Returns the length written, truncated to fit `len`.
+static inline size_t bootTimelineFormat(const BootTimeline& t, char* buf, size_t len) {
+  size_t used = 0;
+  if (!len) return 0;
+  buf[0] = '\0';
+  if (!bootTimelineValid(t)) {
+    bootAppend(buf, len, used, "no boot timeline\n");
+    return used;
+  }
+  bootAppend(buf, len, used, "%-18s %10s %10s %5s\n", "stage", "start us", "us", "calls");
+  bool printed[BOOT_STAGE_COUNT] = {};
+  for (uint8_t n = 0; n < BOOT_STAGE_COUNT; n++) {
+    int8_t first = -1;
+    for (uint8_t i = 0; i < BOOT_STAGE_COUNT; i++) {
+      if (t.stages[i].calls && !printed[i] && (first < 0 || t.stages[i].startUs < t.stages[first].startUs)) first = i;
+    }
+    if (first < 0) break;
+    printed[first] = true;
+    const BootStageTime& s = t.stages[first];
+    bootAppend(buf, len, used, "%-18s %10lu %10lu %5u\n", bootStageNames[first], (unsigned long)s.startUs,
+               (unsigned long)s.us, (unsigned)s.calls);
+  }
+  if (t.doneUs) {
+    bootAppend(buf, len, used, "setup() done at %lu us\n", (unsigned long)t.doneUs);
+  } else {
+    bootAppend(buf, len, used, "setup() did not finish\n");
+  }
+  return used;
+}
+
+// Charges the time until the end of the enclosing block to one stage
+class BootStageScope {
+ public:
+  BootStageScope(BootTimeline& timeline, BootStageId id) : timeline_(timeline), id_(id), start_(micros()) {}
+  ~BootStageScope() { bootTimelineRecord(timeline_, id_, start_, micros()); }
+
+ private:
+  BootTimeline& timeline_;
+  BootStageId id_;
+  uint32_t start_;
+};
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef BOOT_SEQUENCER_H
+#define BOOT_SEQUENCER_H
+
+// Start-up work done while the splash is on screen.
+//
+// setup() used to hold the splash with a fixed delay and only then start
+// WiFi, the web server and the dashboard, so the first live gauge came over
+// six seconds after power-on. Instead the splash time is spent on that
+// work: each bootPoll() runs one step (WiFi AP, server, dashboard sprites),
+// with an ECU probe slipped in every BOOT_PROBE_INTERVAL_MS. The splash ends
+// once every step is done, the ECU has answered and the logo has been up for
+// BOOT_SPLASH_MIN_MS - or after BOOT_SPLASH_MAX_MS with no ECU, so an
+// unplugged display still reaches its gauges.
+
+#include <stdint.h>
+
+#define BOOT_SPLASH_MIN_MS 800     // long enough to read the logo
+#define BOOT_SPLASH_MAX_MS 3000    // give up waiting for the ECU
+#define BOOT_PROBE_INTERVAL_MS 50  // a missing ECU costs a probe timeout each time
+#define BOOT_PROBE_TIMEOUT_MS 20   // longest an unanswered probe holds things up
+
+// One piece of start-up work. Returns true when finished, false to be called again.
+typedef bool (*BootStepFn)();
+
+struct BootStep {
+  const char* name;
+  BootStepFn run;
+};
+
+struct BootSequencer {
+  const BootStep* steps;
+  uint8_t count;
+  uint8_t next;  // first unfinished step
+  bool (*probe)();  // true when a live frame came back from the ECU
+  bool live;
+  uint32_t startMs;
+  uint32_t lastProbeMs;
+};
+
+static inline void bootBegin(BootSequencer& boot, const BootStep* steps, uint8_t count, bool (*probe)(), uint32_t now) {
+  boot.steps = steps;
+  boot.count = count;
+  boot.next = 0;
+  boot.probe = probe;
+  boot.live = false;
+  boot.startMs = now;
+  boot.lastProbeMs = now - BOOT_PROBE_INTERVAL_MS;  // probe straight away
+}
+
+static inline bool bootStepsDone(const BootSequencer& boot) { return boot.next >= boot.count; }
+
+// True once the splash can give way to the gauges
+static inline bool bootSplashDone(const BootSequencer& boot, uint32_t now) {
+  uint32_t shown = now - boot.startMs;
+  return bootStepsDone(boot) && shown >= BOOT_SPLASH_MIN_MS && (boot.live || shown >= BOOT_SPLASH_MAX_MS);
+}
+
+// Do one slice of start-up work: an ECU probe when one is due, otherwise the
+// next unfinished step. Returns bootSplashDone().
+static inline bool bootPoll(BootSequencer& boot, uint32_t now) {
+  if (!boot.live && boot.probe && now - boot.lastProbeMs >= BOOT_PROBE_INTERVAL_MS) {
+    boot.lastProbeMs = now;
+    boot.live = boot.probe();
+  } else if (!bootStepsDone(boot)) {
+    if (boot.steps[boot.next].run()) boot.next++;
+  }
+  return bootSplashDone(boot, now);
+}
+
+// Warm restart: the display reset while the engine was running (a brownout
+// while cranking, a watchdog). The driver shouldn't sit through the splash
+// and sweep for that, so boot goes straight to the gauges when the ECU
+// already reports RPM, or when the reset was unexpected and the RTC marker,
+// which survives every reset but power-on, says the engine was turning.
+#define BOOT_WARM_MARKER 0x52554E31  // "RUN1"
+
+enum BootPath { BOOT_COLD, BOOT_WARM };
+
+static inline BootPath bootChoosePath(bool unexpectedReset, uint32_t marker, bool ecuLive, uint16_t rpm) {
+  if (ecuLive && rpm > 0) return BOOT_WARM;
+  return (unexpectedReset && marker == BOOT_WARM_MARKER) ? BOOT_WARM : BOOT_COLD;
+}
+
+// What the marker should hold for the current RPM
+static inline uint32_t bootWarmMarkerFor(uint16_t rpm) { return rpm ? BOOT_WARM_MARKER : 0; }
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef COLOR_CONVERT_H
+#define COLOR_CONVERT_H
+
+// RGB565 -> RGB666 expansion for the ILI9488's 18-bit SPI interface.
+//
+// Sources are in TFT_eSprite storage order: byte-swapped RGB565, i.e. the high
+// byte (RRRRRGGG) first in memory followed by the low byte (GGGBBBBB). Output
+// is three bytes per pixel with each channel in the top six bits.
+
+#include <stdint.h>
+#include <string.h>
+
+// Reference path, one pixel at a time
+static inline void rgb565ToRgb666Pixel(uint16_t swapped, uint8_t* dst) {
+  uint8_t hi = swapped & 0xFF;
+  uint8_t lo = swapped >> 8;
+  dst[0] = hi & 0xF8;
+  dst[1] = ((hi << 5) | (lo >> 3)) & 0xFC;
+  dst[2] = lo << 3;
+}
+
+// Two pixels from one 32-bit little-endian load; channels end up in bytes 0 and 2
+static inline void rgb565SplitPair(uint32_t w, uint32_t& r, uint32_t& g, uint32_t& b) {
+  r = w & 0x00F800F8;
+  g = ((w << 5) & 0x00E000E0) | ((w >> 11) & 0x001C001C);
+  b = (w >> 5) & 0x00F800F8;
+}
+
+// Convert a run of `count` pixels. Four pixels are handled per step with two
+// 32-bit loads and three 32-bit stores; the tail falls back to the reference path.
+static inline void rgb565ToRgb666Run(const uint16_t* src, uint8_t* dst, int32_t count) {
+  while (count >= 4) {
+    uint32_t w0, w1;
+    memcpy(&w0, src, 4);
+    memcpy(&w1, src + 2, 4);
+
+    uint32_t r0, g0, b0, r1, g1, b1;
+    rgb565SplitPair(w0, r0, g0, b0);
+    rgb565SplitPair(w1, r1, g1, b1);
+
+    uint32_t out[3];
+    out[0] = (r0 & 0xFF) | ((g0 & 0xFF) << 8) | ((b0 & 0xFF) << 16) | ((r0 & 0xFF0000) << 8);
+    out[1] = ((g0 >> 16) & 0xFF) | ((b0 >> 8) & 0xFF00) | ((r1 & 0xFF) << 16) | ((g1 & 0xFF) << 24);
+    out[2] = (b1 & 0xFF) | ((r1 >> 8) & 0xFF00) | (g1 & 0xFF0000) | ((b1 & 0xFF0000) << 8);
+    memcpy(dst, out, 12);
+
+    src += 4;
+    dst += 12;
+    count -= 4;
+  }
+  for (; count > 0; count--) {
+    rgb565ToRgb666Pixel(*src++, dst);
+    dst += 3;
+  }
+}
+
+// Expand `count` 4-bit palette indices, starting at pixel `first` of a packed
+// row (high nibble first, as TFT_eSprite stores them), through a 16-entry
+// palette of pre-converted RGB666 triplets.
+static inline void expand4bppToRgb666(const uint8_t* src, int32_t first, uint8_t* dst, int32_t count,
+                                      const uint8_t* palette666) {
+  src += first >> 1;
+  if ((first & 1) && count > 0) {
+    const uint8_t* c = palette666 + (*src++ & 0x0F) * 3;
+    dst[0] = c[0]; dst[1] = c[1]; dst[2] = c[2];
+    dst += 3;
+    count--;
+  }
+  for (; count >= 2; count -= 2) {
+    uint8_t pair = *src++;
+    const uint8_t* a = palette666 + (pair >> 4) * 3;
+    const uint8_t* b = palette666 + (pair & 0x0F) * 3;
+    dst[0] = a[0]; dst[1] = a[1]; dst[2] = a[2];
+    dst[3] = b[0]; dst[4] = b[1]; dst[5] = b[2];
+    dst += 6;
+  }
+  if (count > 0) {
+    const uint8_t* c = palette666 + (*src >> 4) * 3;
+    dst[0] = c[0]; dst[1] = c[1]; dst[2] = c[2];
+  }
+}
+
+#endif
@@ -0,0 +1,437 @@
+#ifndef DASHBOARD_H
+#define DASHBOARD_H
+
+// Engine state and the main gauge page. Kept free of WiFi/web code so the
+// same rendering runs on the host backend for benchmarks.
+//
+// Build with LAYOUT_COMPILE_TIME for a fixed layout: /layout.bin is ignored
+// and itemDraw() is unrolled over builtinLayout, every widget's position,
+// channel and colour rule folded into straight-line code.
+
+#include <EEPROM.h>
+#include "gauge_sprite.h"
+#include "drawing_utils.h"
+#include "status_row.h"
+#include "background.h"
+#include "gauge_filter.h"
+#include "rpm_interpolator.h"
+#include "startup_sweep.h"
+#include "strip_chart.h"
+#include "layout.h"
+#include "fixed_point.h"
+#include "units.h"
+#include <utility>
+
+void drawData();
+void drawMainPage(bool dirty);
+void eraseMainPage();
+void drawRPMValue(int value);
+void drawDataBox(GaugeSprite& gauge, int x, int y, const int value, uint16_t color, const int decimal, bool setup);
+void eraseDataBox(GaugeSprite& gauge, int x, int y);
+void itemDraw(bool setup);
+uint16_t afrColor(Tenths afr);
+uint16_t cltColor(int clt);
+uint16_t batColor(Tenths bat);
+int gaugeValue(int slot, int raw, bool setup);
+int channelValue(uint8_t channel);
+uint16_t widgetColor(const LayoutWidget& w, int value);
+struct ShownValue;
+ShownValue channelShown(uint8_t channel, int value, uint8_t decimals);
+void loadDisplayUnits();
+void saveDisplayUnits(uint8_t units);
+void drawWidgets(const LayoutWidget* w, const LayoutWidget* end, bool setup);
+const LayoutWidget* layoutWidgetFor(uint8_t channel);
+uint8_t statusFlags();
+void recordHistory(uint32_t now);
+void buildDashboardBackground();
+void forceRedrawFPSLabel();
+void prepareDashboard();
+void startUpDisplay(bool sweep = true);
+void startUpDisplayBegin();
+bool startUpSweepPoll(StartupSweep& sweep, uint32_t now);
+
+int16_t iat = 0, clt = 0;  // degrees C
+uint8_t refreshRate = 0;
+unsigned int rpm = 6000, lastRpm;
+RpmInterpolator rpmInterp;  // fed with each fresh ECU sample, drives the bar
+
+// Short-term history for the strip charts, kept whether or not one is shown
+#define HISTORY_INTERVAL_MS 100
+#define HISTORY_SAMPLES 240  // 24 s
+ChartRing afrHistory, mapHistory;
+int mapData, tps, adv, fp;
+Tenths bat = {}, afrConv = {};  // volts and AFR, as the ECU sends them
+bool syncStatus, fan, ase, wue, rev, launch, airCon, dfco;
+
+// Persistent 4-bit sprite per gauge, in itemDraw() order
+enum GaugeSlot { GAUGE_AFR, GAUGE_TPS, GAUGE_ADV, GAUGE_MAP, GAUGE_IAT, GAUGE_CLT, GAUGE_BAT, GAUGE_FPS, GAUGE_RPM, GAUGE_COUNT };
+GaugeSprite gauges[GAUGE_COUNT];
+DigitCache rpmDigits;  // the RPM readout is redrawn every frame of the sweep and while revving
+
+static_assert((int)GAUGE_RPM == (int)LAYOUT_CHANNELS, "layout channels follow GaugeSlot");
+
+// The built-in value boxes. Fast widgets first; top-left corner of each box,
+// label above the value.
+constexpr LayoutWidget builtinLayout[] = {
+  { LAYOUT_AFR, LAYOUT_TENTHS, LAYOUT_COLOR_AFR, 5, 190, TFT_WHITE, TFT_WHITE, "AFR" },
+  { LAYOUT_TPS, 0, LAYOUT_COLOR_FIXED, 360, 190, TFT_WHITE, TFT_WHITE, "TPS" },
+  { LAYOUT_ADV, 0, LAYOUT_COLOR_FIXED, 120, 190, TFT_RED, TFT_RED, "ADV" },
+  { LAYOUT_MAP, 0, LAYOUT_COLOR_FIXED, 360, 10, TFT_WHITE, TFT_WHITE, "MAP" },
+  { LAYOUT_IAT, LAYOUT_LAZY, LAYOUT_COLOR_FIXED, 5, 10, TFT_WHITE, TFT_WHITE, "IAT" },
+  { LAYOUT_CLT, LAYOUT_LAZY, LAYOUT_COLOR_CLT, 5, 100, TFT_WHITE, TFT_WHITE, "Coolant" },
+  { LAYOUT_BAT, LAYOUT_LAZY | LAYOUT_TENTHS, LAYOUT_COLOR_BAT, 360, 100, TFT_WHITE, TFT_WHITE, "Voltage" },
+  { LAYOUT_FPS, LAYOUT_LAZY, LAYOUT_COLOR_FIXED, 240, 190, TFT_WHITE, TFT_WHITE, "FPS" },  // label follows the mode
+};
+static_assert(layoutTableFits(builtinLayout), "a built-in widget falls outside the 480x320 screen");
+static_assert(!layoutTableOverlaps(builtinLayout), "built-in widgets overlap");
+static_assert(!layoutTableOnReserved(builtinLayout), "a built-in widget covers the RPM bar, RPM readout or status row");
+static_assert(layoutTableValid(builtinLayout), "built-in layout: repeated channel, bad field, wide label or lazy widget before a fast one");
+
+#ifdef LAYOUT_COMPILE_TIME
+constexpr DashLayout dashLayout = layoutFromTable(builtinLayout);
+constexpr bool dashLayoutLoaded = false;
+#else
+DashLayout dashLayout = layoutFromTable(builtinLayout);  // replaced at boot by a valid /layout.bin
+bool dashLayoutLoaded;  // true when dashLayout came from the file
+#endif
+
+// Jitter suppression per channel, in GaugeSlot order. AFR and battery are in
+// tenths, so a deadband of 1 hides a 0.1 flicker.
+const GaugeFilterConfig gaugeFilterConfig[GAUGE_RPM] = {
+  { 1, 300, 250 },   // AFR
+  { 1, 250, 250 },   // TPS
+  { 0, 0, 0 },       // ADV: every degree matters
+  { 1, 250, 250 },   // MAP
+  { 0, 0, 0 },       // IAT (lazy, once a second)
+  { 0, 0, 0 },       // Coolant (lazy)
+  { 1, 2000, 2000 }, // Voltage (lazy)
+  { 2, 2000, 2000 }, // FPS/FP (lazy)
+};
+GaugeFilter gaugeFilters[GAUGE_RPM];
+
+// Filtered reading for a gauge; setup restarts the filter at the raw value
+int gaugeValue(int slot, int raw, bool setup) {
+  if (setup) gaugeFilterReset(gaugeFilters[slot], raw, millis());
+  return gaugeFilterApply(gaugeFilters[slot], gaugeFilterConfig[slot], raw, millis());
+}
+
+// Static labels, blitted once by startUpDisplay()
+Background dashboardBackground;
+uint8_t dashFpsLabelTile;  // tile index of the FPS/FP label
+
+uint32_t lazyUpdateTime;
+
+// One frame of the gauge page, status row included
+void drawData() {
+  RENDER_PROFILE(PROF_FRAME);
+  drawMainPage(false);
+  statusRowDraw(statusFlags());
+  dmaPushEndFrame();
+}
+
+// The gauge page's widgets; `dirty` re-renders every box after a page switch
+void drawMainPage(bool dirty) {
+  // The bar animates at frame rate from the predicted RPM; the digits show the last sample
+  drawRPMBarBlocks(rpmInterp.count ? rpmInterpolatorAt(rpmInterp, millis()) : rpm);
+  if (lastRpm != rpm || dirty) {
+    drawRPMValue(rpm);
+    lastRpm = rpm;
+  }
+  itemDraw(dirty);
+}
+
+// Paint out everything drawMainPage() put on screen, leaving the background tiles
+void eraseMainPage() {
+  drawRPMBarBlocks(0);
+  gaugeSpriteErase(gauges[GAUGE_RPM], 190, 140);
+  for (uint8_t i = 0; i < dashLayout.count; i++) {
+    const LayoutWidget& w = dashLayout.widgets[i];
+    eraseDataBox(gauges[w.channel], w.x, w.y);
+  }
+}
+
+void rpmValueSpriteBegin() {
+  GaugeSprite& gauge = gauges[GAUGE_RPM];
+  if (gauge.sprite) return;
+  gaugeSpriteBegin(gauge, 100, 50, AA_FONT_LARGE, TR_DATUM);
+  if (digitCacheBuild(rpmDigits, *gauge.sprite, TR_DATUM, 5)) gauge.digits = &rpmDigits;
+}
+
+void drawRPMValue(int value) {
+  RENDER_PROFILE(PROF_RPM_VALUE);
+  GaugeSprite& gauge = gauges[GAUGE_RPM];
+  rpmValueSpriteBegin();
+  gaugeSpriteDrawValue(gauge, value, 0, 100, 5);
+  gaugeSpritePush(gauge, 190, 140);
+}
+
+#define DATA_BOX_VALUE_Y 25  // value sprite offset below the top of a data box
+
+void dataBoxSpriteBegin(GaugeSprite& gauge) {
+  const int BOX_WIDTH = 100;  // Reduced width to fit screen
+  const int BOX_HEIGHT = 80;  // Adjusted height
+  const int LABEL_HEIGHT = BOX_HEIGHT / 2;
+
+  gaugeSpriteBegin(gauge, BOX_WIDTH, LABEL_HEIGHT, AA_FONT_LARGE, TC_DATUM);
+}
+
+void drawDataBox(GaugeSprite& gauge, int x, int y, const int value, uint16_t color, const int decimal, bool setup) {
+  RENDER_PROFILE(PROF_DATA_BOX);
+  dataBoxSpriteBegin(gauge);
+  bool recolored = gaugeSpriteSetColor(gauge, color);
+  if (gauge.shown != value || setup) {
+    gaugeSpriteDrawValue(gauge, value, decimal, 50, 5);
+  } else if (!recolored) {
+    return;  // same digits, same colour: nothing to push
+  }
+  gaugeSpritePush(gauge, x, y + DATA_BOX_VALUE_Y);
+}
+
+void eraseDataBox(GaugeSprite& gauge, int x, int y) {
+  gaugeSpriteErase(gauge, x, y + DATA_BOX_VALUE_Y);
+}
+
+constexpr Tenths AFR_RICH = Tenths::fromRaw(130);   // 13.0
+constexpr Tenths AFR_LEAN = Tenths::fromRaw(147);   // 14.7
+constexpr Tenths BAT_LOW = Tenths::fromRaw(115);    // 11.5 V
+constexpr Tenths BAT_HIGH = Tenths::fromRaw(145);   // 14.5 V
+
+uint16_t afrColor(Tenths afr) { return (afr < AFR_RICH) ? TFT_ORANGE : ((afr > AFR_LEAN) ? TFT_RED : TFT_GREEN); }
+uint16_t cltColor(int clt) { return (clt > 95) ? TFT_RED : TFT_WHITE; }
+uint16_t batColor(Tenths bat) { return (bat < BAT_LOW || bat > BAT_HIGH) ? TFT_ORANGE : TFT_GREEN; }
+
+// Raw reading behind a layout channel
+template <uint8_t Channel>
+int channelValueOf() {
+  if constexpr (Channel == LAYOUT_AFR) return afrConv.raw;
+  else if constexpr (Channel == LAYOUT_TPS) return tps;
+  else if constexpr (Channel == LAYOUT_ADV) return adv;
+  else if constexpr (Channel == LAYOUT_MAP) return mapData;
+  else if constexpr (Channel == LAYOUT_IAT) return iat;
+  else if constexpr (Channel == LAYOUT_CLT) return clt;
+  else if constexpr (Channel == LAYOUT_BAT) return bat.raw;
+  else return (EEPROM.read(0) == 1) ? refreshRate : fp;
+}
+
+int channelValue(uint8_t channel) {
+  switch (channel) {
+    case LAYOUT_AFR: return channelValueOf<LAYOUT_AFR>();
+    case LAYOUT_TPS: return channelValueOf<LAYOUT_TPS>();
+    case LAYOUT_ADV: return channelValueOf<LAYOUT_ADV>();
+    case LAYOUT_MAP: return channelValueOf<LAYOUT_MAP>();
+    case LAYOUT_IAT: return channelValueOf<LAYOUT_IAT>();
+    case LAYOUT_CLT: return channelValueOf<LAYOUT_CLT>();
+    case LAYOUT_BAT: return channelValueOf<LAYOUT_BAT>();
+    default: return channelValueOf<LAYOUT_FPS>();
+  }
+}
+
+template <uint8_t Rule>
+uint16_t widgetColorOf(uint16_t fixed, int value) {
+  if constexpr (Rule == LAYOUT_COLOR_AFR) return afrColor(Tenths::fromRaw(value));
+  else if constexpr (Rule == LAYOUT_COLOR_CLT) return cltColor(value);
+  else if constexpr (Rule == LAYOUT_COLOR_BAT) return batColor(Tenths::fromRaw(value));
+  else return fixed;
+}
+
+uint16_t widgetColor(const LayoutWidget& w, int value) {
+  switch (w.colorRule) {
+    case LAYOUT_COLOR_AFR: return widgetColorOf<LAYOUT_COLOR_AFR>(w.color, value);
+    case LAYOUT_COLOR_CLT: return widgetColorOf<LAYOUT_COLOR_CLT>(w.color, value);
+    case LAYOUT_COLOR_BAT: return widgetColorOf<LAYOUT_COLOR_BAT>(w.color, value);
+    default: return w.color;
+  }
+}
+
+// Display unit per channel, UNIT_ALT() bits from units.h. Filters and colour
+// thresholds stay in the ECU's units; only the digits are converted.
+uint8_t displayUnits;
+
+void loadDisplayUnits() {
+  uint8_t stored = EEPROM.read(UNITS_EEPROM_ADDR);
+  displayUnits = ((stored & ~UNITS_MASK) == UNITS_EEPROM_TAG) ? (stored & UNITS_MASK) : 0;
+}
+
+void saveDisplayUnits(uint8_t units) {
+  displayUnits = units & UNITS_MASK;
+  EEPROM.write(UNITS_EEPROM_ADDR, UNITS_EEPROM_TAG | displayUnits);
+  EEPROM.commit();
+}
+
+// A filtered reading as its box shows it: `value` with `decimals` implied places
+struct ShownValue {
+  int32_t value;
+  uint8_t decimals;
+};
+
+template <uint8_t Channel>
+ShownValue channelShownOf(int value, uint8_t decimals) {
+  if constexpr (Channel == LAYOUT_CLT) {
+    if (displayUnits & UNIT_ALT(UNIT_CLT)) return { unitFahrenheit(value), 0 };
+  } else if constexpr (Channel == LAYOUT_IAT) {
+    if (displayUnits & UNIT_ALT(UNIT_IAT)) return { unitFahrenheit(value), 0 };
+  } else if constexpr (Channel == LAYOUT_MAP) {
+    if (displayUnits & UNIT_ALT(UNIT_MAP)) return { unitPsiTenths(value), 1 };
+  } else if constexpr (Channel == LAYOUT_AFR) {
+    if (displayUnits & UNIT_ALT(UNIT_AFR)) return { unitLambdaHundredths(value), 2 };
+  }
+  return { value, decimals };
+}
+
+ShownValue channelShown(uint8_t channel, int value, uint8_t decimals) {
+  switch (channel) {
+    case LAYOUT_CLT: return channelShownOf<LAYOUT_CLT>(value, decimals);
+    case LAYOUT_IAT: return channelShownOf<LAYOUT_IAT>(value, decimals);
+    case LAYOUT_MAP: return channelShownOf<LAYOUT_MAP>(value, decimals);
+    case LAYOUT_AFR: return channelShownOf<LAYOUT_AFR>(value, decimals);
+    default: return { value, decimals };
+  }
+}
+
+void drawWidgets(const LayoutWidget* w, const LayoutWidget* end, bool setup) {
+  for (; w < end; w++) {
+    int value = gaugeValue(w->channel, channelValue(w->channel), setup);
+    ShownValue shown = channelShown(w->channel, value, layoutDecimals(*w));
+    drawDataBox(gauges[w->channel], w->x, w->y, shown.value, widgetColor(*w, value), shown.decimals, setup);
+  }
+}
+
+#ifdef LAYOUT_COMPILE_TIME
+// builtinLayout[I] with everything about it known to the compiler
+template <size_t I>
+void drawBuiltinWidget(bool setup) {
+  constexpr LayoutWidget w = builtinLayout[I];
+  int value = gaugeValue(w.channel, channelValueOf<w.channel>(), setup);
+  ShownValue shown = channelShownOf<w.channel>(value, layoutDecimals(w));
+  drawDataBox(gauges[w.channel], w.x, w.y, shown.value, widgetColorOf<w.colorRule>(w.color, value), shown.decimals, setup);
+}
+
+template <size_t First, size_t... I>
+void drawBuiltinWidgets(std::index_sequence<I...>, bool setup) {
+  (drawBuiltinWidget<First + I>(setup), ...);
+}
+
+void itemDraw(bool setup) {
+  constexpr size_t fast = layoutFastCount(builtinLayout);
+  constexpr size_t count = sizeof(builtinLayout) / sizeof(builtinLayout[0]);
+  drawBuiltinWidgets<0>(std::make_index_sequence<fast>(), setup);
+  if ((millis() - lazyUpdateTime > 1000) || setup) {
+    drawBuiltinWidgets<fast>(std::make_index_sequence<count - fast>(), setup);
+    lazyUpdateTime = millis();
+  }
+}
+#else
+void itemDraw(bool setup) {
+  const LayoutWidget* widgets = dashLayout.widgets;
+  drawWidgets(widgets, widgets + dashLayout.fastCount, setup);
+  if ((millis() - lazyUpdateTime > 1000) || setup) {
+    drawWidgets(widgets + dashLayout.fastCount, widgets + dashLayout.count, setup);
+    lazyUpdateTime = millis();
+  }
+}
+#endif
+
+const LayoutWidget* layoutWidgetFor(uint8_t channel) {
+  for (uint8_t i = 0; i < dashLayout.count; i++) {
+    if (dashLayout.widgets[i].channel == channel) return &dashLayout.widgets[i];
+  }
+  return nullptr;
+}
+
+// Status flags packed in button order, bit 0 = SYNC ... bit 7 = DFCO
+uint8_t statusFlags() {
+  return syncStatus | (fan << 1) | (ase << 2) | (wue << 3) | (rev << 4) | (launch << 5) | (airCon << 6) | (dfco << 7);
+}
+
+void recordHistory(uint32_t now) {
+  static uint32_t lastSample;
+  if (!afrHistory.samples) {
+    chartRingBegin(afrHistory, HISTORY_SAMPLES);
+    chartRingBegin(mapHistory, HISTORY_SAMPLES);
+  }
+  if (now - lastSample < HISTORY_INTERVAL_MS) return;
+  lastSample = now;
+  chartRingPush(afrHistory, afrConv.raw);
+  chartRingPush(mapHistory, mapData);
+}
+
+// Render the page's static labels once; the FPS/FP label follows the display mode
+void buildDashboardBackground() {
+  Background& bg = dashboardBackground;
+  backgroundClear(bg, TFT_BLACK);
+  backgroundAddText(bg, "RPM", 240, 120, TC_DATUM, TFT_WHITE, AA_FONT_SMALL);
+  for (uint8_t i = 0; i < dashLayout.count; i++) {
+    const LayoutWidget& w = dashLayout.widgets[i];
+    const char* label = w.label;
+    if (w.channel == LAYOUT_FPS) {
+      label = (EEPROM.read(0) == 1) ? "FPS" : "FP";
+      dashFpsLabelTile = bg.count;
+    }
+    backgroundAddText(bg, label, w.x + 50, w.y + 5, TC_DATUM, w.labelColor, AA_FONT_SMALL);
+  }
+}
+
+void forceRedrawFPSLabel() {
+  // Force redraw just the FPS/FP label and value
+  const LayoutWidget* w = layoutWidgetFor(LAYOUT_FPS);
+  if (!w) {
+    buildDashboardBackground();
+    return;
+  }
+  int value = gaugeValue(GAUGE_FPS, channelValue(LAYOUT_FPS), true);
+  
+  // Clear the label area first: "FP" is narrower than "FPS"
+  dmaPushFlush();
+  display.fillRect(w->x, w->y, 100, 25, TFT_BLACK);
+  
+  // Redraw the label and value
+  buildDashboardBackground();
+  backgroundBlitTile(dashboardBackground, dashFpsLabelTile);
+  drawDataBox(gauges[GAUGE_FPS], w->x, w->y, value, widgetColor(*w, value), layoutDecimals(*w), true);
+}
+
+// Everything startUpDisplay() needs that doesn't touch the panel: label
+// tiles, the status button cache and the value sprites with their font
+// loaded. Done during the splash, so the first frame only has to push.
+void prepareDashboard() {
+  if (!dashboardBackground.count) buildDashboardBackground();
+  statusRowBegin();
+  rpmValueSpriteBegin();
+  for (uint8_t i = 0; i < dashLayout.count; i++) dataBoxSpriteBegin(gauges[dashLayout.widgets[i].channel]);
+}
+
+// The gauge page without the RPM bar and readout
+void startUpDisplayBegin() {
+  prepareDashboard();
+  backgroundBlit(dashboardBackground);
+  itemDraw(true);
+  statusRowDraw(statusFlags(), true);
+}
+
+// Draw the sweep's frame if one is due. Returns true once the sweep is over.
+bool startUpSweepPoll(StartupSweep& sweep, uint32_t now) {
+  if (sweepFrameDue(sweep, now)) {
+    int32_t value = sweepRpmAt(sweep, now);
+    drawRPMBarBlocks(value, 6000, sweep.frames == 0);  // the first frame paints every block
+    drawRPMValue(value);  // left on the wire while the caller gets on with the gap
+    sweepFrameDrawn(sweep, now);
+  }
+  return sweep.done;
+}
+
+// `sweep`: run the bar down from full scale; skipped on a warm restart. Blocks
+// until the sweep is over; setup() polls it instead to use the gaps.
+void startUpDisplay(bool sweep) {
+  startUpDisplayBegin();
+  if (!sweep) {
+    drawRPMBarBlocks(rpm, 6000, true);
+    drawRPMValue(rpm);
+    return;
+  }
+  StartupSweep s;
+  sweepBegin(s, 6000, millis());
+  while (!startUpSweepPoll(s, millis())) delay(sweepSpareMs(s, millis()));
+  lazyUpdateTime = millis();  // the slow boxes count from when the page went live, as after setup()
+}
+
+#endif
@@ -0,0 +1,144 @@
+#ifndef DIGIT_CACHE_H
+#define DIGIT_CACHE_H
+
+// Pre-rendered digits for a 4-bit gauge sprite.
+//
+// drawString() with a smooth font looks up and alpha-blends every glyph pixel
+// each time a number changes, which on the C3 costs more than pushing the
+// sprite. The RPM readout only ever shows digits, so each one is rendered
+// once into the gauge's own sprite and its ink box kept as palette indices;
+// a number is then laid out with the font's advances and copied in. The
+// advances and the width of the last glyph come from textWidth(), so the
+// layout, and every pixel, matches what drawString() would have produced.
+// A font whose digits ink outside their own advance is refused, as the
+// copies could then differ where neighbours overlap.
+
+#include <TFT_eSPI.h>
+#include <stdlib.h>
+
+struct DigitGlyph {
+  int16_t left, top;  // ink box, from the pen position and from the sprite's top row
+  int16_t width, height;
+  int16_t advance;    // pen move to the next digit
+  int16_t lastWidth;  // what textWidth() counts for it as the last character
+  uint32_t offset;    // into DigitCache::ink
+};
+
+struct DigitCache {
+  DigitGlyph glyphs[10];
+  uint8_t* ink;  // every glyph's box, one palette index per byte; null until built
+  uint8_t datum;
+  int32_t y;     // sprite row the digits were rendered at
+};
+
+static inline uint8_t digitCacheNibble(const uint8_t* row, int32_t x) {
+  return (x & 1) ? (row[x >> 1] & 0x0F) : (row[x >> 1] >> 4);
+}
+
+// Render `digit` at pen (x, y) and find its ink box; false if there is no ink
+static bool digitCacheMeasure(TFT_eSprite& s, char digit, int32_t x, int32_t y, DigitGlyph& g) {
+  const char text[2] = { digit, '\0' };
+  s.fillSprite(0);
+  s.drawString(text, x, y);
+  const uint8_t* pixels = (const uint8_t*)s.getPointer();
+  int32_t stride = (s.width() + 1) / 2;
+  int32_t x0 = s.width(), y0 = s.height(), x1 = -1, y1 = -1;
+  for (int32_t r = 0; r < s.height(); r++) {
+    for (int32_t c = 0; c < s.width(); c++) {
+      if (!digitCacheNibble(pixels + r * stride, c)) continue;
+      x0 = min(x0, c);
+      x1 = max(x1, c);
+      y0 = min(y0, r);
+      y1 = max(y1, r);
+    }
+  }
+  if (x1 < 0) return false;
+  g.left = x0 - x;
+  g.top = y0;
+  g.width = x1 - x0 + 1;
+  g.height = y1 - y0 + 1;
+  return true;
+}
+
+/**
+ * @brief Render 0-9 once with the sprite's loaded font
+ * @param datum The text datum the gauge draws with: TL_DATUM, TC_DATUM or TR_DATUM
+ * @param y The row the gauge draws its text at
+ * @return false if the font can't be cached; digitCacheDraw() then always declines
+ *
+ * Uses the sprite as scratch and leaves it cleared, with its datum restored.
+ */
+bool digitCacheBuild(DigitCache& cache, TFT_eSprite& s, uint8_t datum, int32_t y) {
+  if (cache.ink || s.getColorDepth() != 4 || !s.getPointer()) return false;
+  uint8_t spriteDatum = s.getTextDatum();
+  s.setTextDatum(TL_DATUM);
+  int32_t pen = s.width() / 4;  // room for a glyph that starts left of its pen
+  uint32_t bytes = 0;
+  bool ok = true;
+  for (uint8_t d = 0; d < 10 && ok; d++) {
+    DigitGlyph& g = cache.glyphs[d];
+    const char one[2] = { (char)('0' + d), '\0' }, two[3] = { (char)('0' + d), '0', '\0' };
+    g.advance = s.textWidth(two) - s.textWidth("0");
+    g.lastWidth = s.textWidth(one);
+    ok = digitCacheMeasure(s, '0' + d, pen, y, g) && g.left >= 0 && g.left + g.width <= g.advance &&
+         pen + g.lastWidth <= s.width();
+    g.offset = bytes;
+    bytes += g.width * g.height;
+  }
+  cache.ink = ok ? (uint8_t*)malloc(bytes) : nullptr;
+  for (uint8_t d = 0; d < 10 && cache.ink; d++) {
+    DigitGlyph& g = cache.glyphs[d];
+    digitCacheMeasure(s, '0' + d, pen, y, g);
+    const uint8_t* pixels = (const uint8_t*)s.getPointer();
+    int32_t stride = (s.width() + 1) / 2;
+    uint8_t* out = cache.ink + g.offset;
+    for (int32_t r = 0; r < g.height; r++) {
+      for (int32_t c = 0; c < g.width; c++) *out++ = digitCacheNibble(pixels + (g.top + r) * stride, pen + g.left + c);
+    }
+  }
+  s.fillSprite(0);
+  s.setTextDatum(spriteDatum);
+  cache.datum = datum;
+  cache.y = y;
+  return cache.ink != nullptr;
+}
+
+/**
+ * @brief Draw `text` into a cleared sprite as drawString(text, x, y) would
+ * @return false, having drawn nothing, unless the cache is built for this row
+ *         and `text` is all digits
+ */
+bool digitCacheDraw(const DigitCache& cache, TFT_eSprite& s, const char* text, int32_t x, int32_t y) {
+  if (!cache.ink || y != cache.y || !*text) return false;
+  int32_t width = 0;
+  for (const char* c = text; *c; c++) {
+    if (*c < '0' || *c > '9') return false;
+    const DigitGlyph& g = cache.glyphs[*c - '0'];
+    width += c[1] ? g.advance : g.lastWidth;
+  }
+  if (cache.datum == TC_DATUM) x -= width / 2;
+  else if (cache.datum == TR_DATUM) x -= width;
+
+  uint8_t* pixels = (uint8_t*)s.getPointer();
+  int32_t stride = (s.width() + 1) / 2;
+  for (const char* c = text; *c; c++) {
+    const DigitGlyph& g = cache.glyphs[*c - '0'];
+    const uint8_t* ink = cache.ink + g.offset;
+    for (int32_t r = 0; r < g.height; r++) {
+      int32_t row = g.top + r;
+      if (row < 0 || row >= s.height()) continue;
+      uint8_t* line = pixels + row * stride;
+      for (int32_t col = 0; col < g.width; col++) {
+        uint8_t index = ink[r * g.width + col];
+        int32_t px = x + g.left + col;
+        if (!index || px < 0 || px >= s.width()) continue;
+        if (px & 1) line[px >> 1] = (line[px >> 1] & 0xF0) | index;
+        else line[px >> 1] = (line[px >> 1] & 0x0F) | (index << 4);
+      }
+    }
+    x += g.advance;
+  }
+  return true;
+}
+
+#endif
@@ -0,0 +1,193 @@
+#ifndef DMA_PUSH_H
+#define DMA_PUSH_H
+
+// DMA-backed pixel pushes for the ILI9488.
+//
+// The ILI9488 only accepts 18-bit colour over SPI, so every pixel goes out as
+// three bytes. Pushes are converted into one of two ping-pong line buffers and
+// queued to the SPI DMA; while one buffer is on the wire the CPU fills the other,
+// and once the last chunk of a window is queued the caller is free to render the
+// next gauge. Anything that talks to `display` directly must call dmaPushFlush()
+// first so the bus is idle and the transaction is closed.
+
+#include <TFT_eSPI.h>
+#include "color_convert.h"
+
+// Pixels per ping-pong buffer (each buffer holds DMA_PUSH_BUF_PIXELS * 3 bytes)
+#ifndef DMA_PUSH_BUF_PIXELS
+#define DMA_PUSH_BUF_PIXELS 2000
+#endif
+
+#ifndef SPI_FREQUENCY
+#define SPI_FREQUENCY 20000000
+#endif
+
+// Fills `lines` rows of a `width` pixel wide window, starting at window row `line`,
+// as packed RGB666 bytes (R, G, B per pixel, colour in the top 6 bits of each byte).
+typedef void (*DmaLineFill)(uint8_t* dst, int16_t line, int16_t lines, int16_t width, void* ctx);
+
+struct DmaPushStats {
+  uint32_t pushes;         // windows pushed since boot
+  uint32_t bytes;          // bytes sent since boot
+  uint32_t fillUs;         // CPU time spent converting into the line buffers
+  uint32_t waitUs;         // CPU time spent blocked on the DMA
+  uint32_t frameBytes;     // bytes sent in the current frame
+  uint32_t frameWaitUs;    // time blocked on the DMA in the current frame
+  uint32_t lastFrameBytes;
+  uint32_t lastFrameSavedUs;  // wire time minus blocked time for the last frame
+  uint32_t avgFrameSavedUs;   // running average of lastFrameSavedUs
+};
+
+DmaPushStats dmaPushStats;
+
+static uint8_t* dmaPushBuf[2] = { nullptr, nullptr };
+static uint8_t dmaPushBufIdx = 0;
+static bool dmaPushOpen = false;  // startWrite() outstanding, last chunk may still be in flight
+
+static inline uint32_t dmaWireTimeUs(uint32_t bytes) {
+  return (uint32_t)(((uint64_t)bytes * 8 * 1000000UL) / SPI_FREQUENCY);
+}
+
+bool initDmaPush() {
+  const size_t size = DMA_PUSH_BUF_PIXELS * 3;
+  for (int i = 0; i < 2; i++) {
+#if defined(ESP32)
+    dmaPushBuf[i] = (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_DMA);
+#else
+    dmaPushBuf[i] = (uint8_t*)malloc(size);
+#endif
+    if (!dmaPushBuf[i]) return false;
+  }
+#if defined(ESP32_DMA)
+  display.initDMA();
+#endif
+  return true;
+}
+
+static void dmaPushWaitIdle() {
+#if defined(ESP32_DMA)
+  if (!display.dmaBusy()) return;
+  uint32_t start = micros();
+  display.dmaWait();
+  uint32_t waited = micros() - start;
+  dmaPushStats.waitUs += waited;
+  dmaPushStats.frameWaitUs += waited;
+#endif
+}
+
+// Queue `len` bytes from `buf`. The buffer must stay untouched until the next send or flush.
+static void dmaPushSend(uint8_t* buf, uint32_t len) {
+  dmaPushStats.bytes += len;
+  dmaPushStats.frameBytes += len;
+#if defined(ESP32_DMA)
+  uint32_t even = len & ~1UL;
+  dmaPushWaitIdle();
+  if (even) display.pushPixelsDMA((uint16_t*)buf, even / 2);
+  if (even != len) {
+    // Odd byte count: the DMA moves 16-bit words, finish the tail by hand
+    dmaPushWaitIdle();
+    display.getSPIinstance().writeBytes(buf + even, len - even);
+  }
+#else
+  uint32_t start = micros();
+  display.getSPIinstance().writeBytes(buf, len);
+  uint32_t waited = micros() - start;
+  dmaPushStats.waitUs += waited;
+  dmaPushStats.frameWaitUs += waited;
+#endif
+}
+
+// Wait for the transfer in flight and release the bus
+void dmaPushFlush() {
+  if (!dmaPushOpen) return;
+  dmaPushWaitIdle();
+  display.endWrite();
+  dmaPushOpen = false;
+}
+
+// Push a w x h window whose rows are `rowBytes` long as they go on the wire,
+// for pixel formats other than RGB666. `fill` writes whole rows in that format.
+void pushWindowBytesDMA(int32_t x, int32_t y, int32_t w, int32_t h, int32_t rowBytes, DmaLineFill fill, void* ctx) {
+  if (w <= 0 || h <= 0 || rowBytes <= 0) return;
+
+  int32_t linesPerChunk = DMA_PUSH_BUF_PIXELS * 3 / rowBytes;
+  if (linesPerChunk < 1) linesPerChunk = 1;
+  // Keep chunks an even number of bytes so only the final one can need a tail write
+  if ((rowBytes & 1) && linesPerChunk > 1) linesPerChunk &= ~1;
+
+  if (dmaPushOpen) {
+    dmaPushWaitIdle();  // the window can't move while the previous one is still streaming
+  } else {
+    display.startWrite();
+    dmaPushOpen = true;
+  }
+  bool swap = display.getSwapBytes();
+  display.setSwapBytes(false);
+  display.setAddrWindow(x, y, w, h);
+
+  for (int32_t line = 0; line < h; line += linesPerChunk) {
+    int32_t lines = (h - line < linesPerChunk) ? (h - line) : linesPerChunk;
+    uint8_t* buf = dmaPushBuf[dmaPushBufIdx];
+    dmaPushBufIdx ^= 1;
+
+    uint32_t start = micros();
+    fill(buf, line, lines, w, ctx);
+    dmaPushStats.fillUs += micros() - start;
+
+    dmaPushSend(buf, (uint32_t)lines * rowBytes);
+  }
+
+  display.setSwapBytes(swap);
+  dmaPushStats.pushes++;
+}
+
+// Push a w x h window whose pixels are produced by `fill`. Returns once the last
+// chunk is queued; the window must lie fully on screen.
+void pushWindowDMA(int32_t x, int32_t y, int32_t w, int32_t h, DmaLineFill fill, void* ctx) {
+  pushWindowBytesDMA(x, y, w, h, w * 3, fill, ctx);
+}
+
+struct DmaSpriteSource {
+  TFT_eSprite* sprite;
+  int32_t sx, sy;
+};
+
+static void dmaFillFromSprite16(uint8_t* dst, int16_t line, int16_t lines, int16_t width, void* ctx) {
+  DmaSpriteSource* src = (DmaSpriteSource*)ctx;
+  const uint16_t* pixels = (const uint16_t*)src->sprite->getPointer();
+  int32_t stride = src->sprite->width();
+  for (int16_t l = 0; l < lines; l++) {
+    rgb565ToRgb666Run(pixels + (src->sy + line + l) * stride + src->sx, dst, width);
+    dst += width * 3;
+  }
+}
+
+// Push the (sx, sy, sw, sh) region of a sprite to (x, y) on screen
+void pushSpriteRegionDMA(TFT_eSprite& sprite, int32_t x, int32_t y, int32_t sx, int32_t sy, int32_t sw, int32_t sh) {
+  bool onScreen = x >= 0 && y >= 0 && x + sw <= display.width() && y + sh <= display.height();
+  if (!dmaPushBuf[0] || !onScreen || sprite.getColorDepth() != 16) {
+    // Let the library clip or expand it the slow way
+    dmaPushFlush();
+    sprite.pushSprite(x, y, sx, sy, sw, sh);
+    return;
+  }
+  DmaSpriteSource src = { &sprite, sx, sy };
+  pushWindowDMA(x, y, sw, sh, dmaFillFromSprite16, &src);
+}
+
+void pushSpriteDMA(TFT_eSprite& sprite, int32_t x, int32_t y) {
+  pushSpriteRegionDMA(sprite, x, y, 0, 0, sprite.width(), sprite.height());
+}
+
+// Close out a rendered frame and update the CPU-time-returned figures
+void dmaPushEndFrame() {
+  uint32_t wire = dmaWireTimeUs(dmaPushStats.frameBytes);
+  uint32_t saved = (wire > dmaPushStats.frameWaitUs) ? (wire - dmaPushStats.frameWaitUs) : 0;
+  dmaPushStats.lastFrameBytes = dmaPushStats.frameBytes;
+  dmaPushStats.lastFrameSavedUs = saved;
+  dmaPushStats.avgFrameSavedUs = (dmaPushStats.avgFrameSavedUs * 15 + saved) / 16;
+  dmaPushStats.frameBytes = 0;
+  dmaPushStats.frameWaitUs = 0;
+}
+
+#endif
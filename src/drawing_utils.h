@@ -2,23 +2,13 @@
 #define DRAWING_UTILS_H
 
 #include "text_utils.h"
+#include "render_profiler.h"
 
-void drawCenteredTextSmall(int x, int y, int w, int h, const char* text, int textSize, uint16_t color) {
-  display.setTextDatum(MC_DATUM);
-  display.setTextColor(color, TFT_BLACK);
-  display.drawString(text, x, y); 
-}
-
-void drawSmallButton(int x, int y, const char* label, bool value) {
-  const int BTN_WIDTH = 50;
-  const int BTN_HEIGHT = 30;
-  uint16_t activeColor = (label == "REV" || label == "LCH" ) ? TFT_RED : TFT_GREEN;
-  uint16_t fillColor = value ? activeColor : TFT_WHITE; 
-  display.drawRoundRect(x, y, BTN_WIDTH, BTN_HEIGHT, 5, fillColor);
-  drawCenteredTextSmall(x+BTN_WIDTH/2, y+BTN_HEIGHT/2, BTN_WIDTH, BTN_HEIGHT, label, 1, fillColor);
-}
-
-void drawRPMBarBlocks(int rpm, int maxRPM = 6000) {
+// Only blocks whose state changed since the last call are repainted; `force`
+// repaints all of them (after the screen was cleared)
+void drawRPMBarBlocks(int rpm, int maxRPM = 6000, bool force = false) {
+  static int shownBlocks = 0;
+  RENDER_PROFILE(PROF_RPM_BAR);
   int startX = 120;     // Starting X position
   int startY[30] = {80, 75, 70, 65, 60, 57, 54, 51, 48, 46, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45};
   int blockWidth = 6; // Width of each block
@@ -27,10 +17,15 @@ void drawRPMBarBlocks(int rpm, int maxRPM = 6000) {
   int numBlocks = 30;  // Total number of blocks
 
   // Calculate number of filled blocks based on RPM value
-  int filledBlocks = map(rpm, 0, maxRPM, 0, numBlocks);
+  int filledBlocks = constrain(map(rpm, 0, maxRPM, 0, numBlocks), 0, numBlocks);
+  int first = force ? 0 : min(filledBlocks, shownBlocks);
+  int last = force ? numBlocks : max(filledBlocks, shownBlocks);
+  shownBlocks = filledBlocks;
+  if (first == last) return;
+  dmaPushFlush();
   
-  // Draw the blocks one by one
-  for (int i = 0; i < numBlocks; i++) {
+  // Draw the changed blocks one by one
+  for (int i = first; i < last; i++) {
     int x = startX + i * (blockWidth + spacing);
     int y = startY[i];
     uint16_t color = TFT_BLACK; // Default color for empty block
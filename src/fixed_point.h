@@ -0,0 +1,47 @@
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+// Scaled-integer channel values.
+//
+// The ECU already sends AFR and battery voltage in tenths, so they are
+// decoded that way: Fixed<10> holds 14.7 as 147 and compares against
+// thresholds of the same scale. The scale is part of the type, so a tenths
+// value can't be compared with a whole-number threshold by mistake. The type
+// stops at decode and the colour thresholds; the filters, history and
+// formatter share one path with every other channel and take .raw, with the
+// decimal places coming from the layout. None of it touches float - every
+// float operation is a library call on the C3, which has no FPU.
+
+#include <stdint.h>
+
+constexpr bool fixedPowerOfTen(int32_t scale) { return scale == 1 || (scale > 1 && scale % 10 == 0 && fixedPowerOfTen(scale / 10)); }
+
+// Places after the point for a power-of-ten scale
+constexpr uint8_t fixedDecimals(int32_t scale) { return (scale < 10) ? 0 : 1 + fixedDecimals(scale / 10); }
+
+template <int32_t Scale>
+struct Fixed {
+  static_assert(fixedPowerOfTen(Scale), "Fixed scale must be a power of ten");
+  static constexpr int32_t scale = Scale;
+  static constexpr uint8_t decimals = fixedDecimals(Scale);
+
+  int32_t raw;  // value * Scale
+
+  static constexpr Fixed fromRaw(int32_t raw) { return Fixed{ raw }; }
+  static constexpr Fixed fromWhole(int32_t whole) { return Fixed{ whole * Scale }; }
+
+  constexpr int32_t whole() const { return raw / Scale; }  // truncated toward zero
+
+  constexpr bool operator==(Fixed b) const { return raw == b.raw; }
+  constexpr bool operator!=(Fixed b) const { return raw != b.raw; }
+  constexpr bool operator<(Fixed b) const { return raw < b.raw; }
+  constexpr bool operator>(Fixed b) const { return raw > b.raw; }
+  constexpr bool operator<=(Fixed b) const { return raw <= b.raw; }
+  constexpr bool operator>=(Fixed b) const { return raw >= b.raw; }
+  constexpr Fixed operator+(Fixed b) const { return Fixed{ raw + b.raw }; }
+  constexpr Fixed operator-(Fixed b) const { return Fixed{ raw - b.raw }; }
+};
+
+typedef Fixed<10> Tenths;
+
+#endif
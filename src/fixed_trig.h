@@ -0,0 +1,69 @@
+#ifndef FIXED_TRIG_H
+#define FIXED_TRIG_H
+
+// Fixed-point sine/cosine from a table built at compile time.
+//
+// Angles are in binary units of 1/1024 turn (about 0.35 degrees), clockwise
+// from 12 o'clock for the gauge code; results are Q14 (16384 = 1.0). The
+// quarter-wave table is generated by constexpr code, so it lands in flash
+// with no float math at runtime - the C3 has no FPU.
+
+#include <stdint.h>
+
+#define TRIG_TURN 1024
+#define TRIG_QUARTER (TRIG_TURN / 4)
+#define TRIG_ONE 16384  // Q14
+
+struct TrigTable {
+  int16_t q14[TRIG_QUARTER + 1];
+};
+
+// Taylor series, accurate to well below one Q14 step over [0, pi/2]
+constexpr double trigTaylorSin(double x) {
+  double term = x, sum = x;
+  for (int n = 1; n < 12; n++) {
+    term *= -x * x / ((2 * n) * (2 * n + 1));
+    sum += term;
+  }
+  return sum;
+}
+
+constexpr TrigTable makeTrigTable() {
+  TrigTable t = {};
+  for (int i = 0; i <= TRIG_QUARTER; i++) {
+    t.q14[i] = (int16_t)(trigTaylorSin(i * 1.5707963267948966 / TRIG_QUARTER) * TRIG_ONE + 0.5);
+  }
+  return t;
+}
+
+constexpr TrigTable trigTable = makeTrigTable();
+static_assert(trigTable.q14[0] == 0 && trigTable.q14[TRIG_QUARTER] == TRIG_ONE, "sine table endpoints");
+
+static inline int32_t isin(int32_t angle) {
+  angle &= TRIG_TURN - 1;
+  if (angle < TRIG_QUARTER) return trigTable.q14[angle];
+  if (angle < 2 * TRIG_QUARTER) return trigTable.q14[2 * TRIG_QUARTER - angle];
+  if (angle < 3 * TRIG_QUARTER) return -trigTable.q14[angle - 2 * TRIG_QUARTER];
+  return -trigTable.q14[TRIG_TURN - angle];
+}
+
+static inline int32_t icos(int32_t angle) { return isin(angle + TRIG_QUARTER); }
+
+// Integer square root, floor(sqrt(v))
+static inline uint32_t isqrt32(uint32_t v) {
+  uint32_t root = 0;
+  uint32_t bit = 1UL << 30;
+  while (bit > v) bit >>= 2;
+  while (bit) {
+    if (v >= root + bit) {
+      v -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return root;
+}
+
+#endif
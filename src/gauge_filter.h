@@ -0,0 +1,67 @@
+#ifndef GAUGE_FILTER_H
+#define GAUGE_FILTER_H
+
+// Per-channel redraw suppression for the numeric gauges.
+//
+// A sensor sitting on a boundary (MAP 35/36 kPa, AFR 14.6/14.7) flips by one
+// count every few frames, and each flip costs a sprite render and a push. The
+// filter holds the displayed value until the input either jumps past the
+// channel's deadband - shown straight away, same frame - or has stayed at a
+// new in-band value for `settleMs` and at least `minIntervalMs` has passed
+// since the last redraw. Returning to the shown value cancels a pending
+// change, so noise that oscillates around it never gets through.
+
+#include <stdint.h>
+
+struct GaugeFilterConfig {
+  uint16_t deadband;       // changes up to this many counts are treated as noise
+  uint16_t settleMs;       // how long an in-band change must hold before it is shown
+  uint16_t minIntervalMs;  // minimum time between in-band redraws
+};
+
+struct GaugeFilter {
+  int32_t shown;          // value the gauge is displaying
+  int32_t pending;        // in-band candidate waiting to settle
+  uint32_t pendingSince;
+  uint32_t lastChange;    // when `shown` last changed
+  bool primed;
+};
+
+// Start from `value` unfiltered, e.g. when the page is (re)drawn
+static inline void gaugeFilterReset(GaugeFilter& f, int32_t value, uint32_t now) {
+  f.shown = value;
+  f.pending = value;
+  f.pendingSince = now;
+  f.lastChange = now;
+  f.primed = true;
+}
+
+// Feed the latest reading; returns the value to display
+static inline int32_t gaugeFilterApply(GaugeFilter& f, const GaugeFilterConfig& config, int32_t raw, uint32_t now) {
+  if (!f.primed) {
+    gaugeFilterReset(f, raw, now);
+    return raw;
+  }
+  int32_t delta = raw - f.shown;
+  if (delta < 0) delta = -delta;
+
+  if (delta == 0) {
+    f.pending = raw;  // back where we were: drop any pending change
+  } else if (delta > config.deadband) {
+    f.shown = raw;    // a real move, show it now
+    f.pending = raw;
+    f.lastChange = now;
+  } else {
+    if (raw != f.pending) {
+      f.pending = raw;
+      f.pendingSince = now;
+    }
+    if (now - f.pendingSince >= config.settleMs && now - f.lastChange >= config.minIntervalMs) {
+      f.shown = raw;
+      f.lastChange = now;
+    }
+  }
+  return f.shown;
+}
+
+#endif
@@ -0,0 +1,174 @@
+#ifndef GAUGE_SPRITE_H
+#define GAUGE_SPRITE_H
+
+// Persistent 4-bit palettised sprites for the numeric gauges.
+//
+// A gauge box only ever holds one text colour on black plus the anti-alias
+// steps between them, so it is drawn with palette indices instead of colours:
+// text colour 15 on background 0. TFT_eSPI blends smooth-font edges with
+// alphaBlend(), and blending 0x000F over 0x0000 only touches the blue channel,
+// which lands the edge pixels on indices 0..14 - a coverage ramp. The palette
+// then maps that ramp from the background to the gauge colour, so a threshold
+// recolour (AFR lean/rich, hot coolant) is a 16 entry palette rebuild and a
+// push, not a re-render. At 4 bpp a 100x40 box is 2 KB instead of 8 KB, which
+// is what lets every gauge keep its own sprite (and loaded font) for good.
+
+#include <TFT_eSPI.h>
+#include "color_convert.h"
+#include "digit_cache.h"
+#include "dma_push.h"
+#include "text_utils.h"
+
+#define GAUGE_INK 15  // palette index used as the text colour
+
+struct GaugeSprite {
+  TFT_eSprite* sprite;
+  uint16_t color;
+  uint16_t background;
+  int32_t shown;  // value currently rendered into the sprite
+  const DigitCache* digits;  // optional pre-rendered digits, see digit_cache.h
+  uint8_t palette666[16 * 3];
+};
+
+// Palette entry `index` of the coverage ramp from `background` to `color`
+uint16_t gaugeRampColor(uint8_t index, uint16_t color, uint16_t background) {
+  return (index == GAUGE_INK) ? color : display.alphaBlend((index * 255) / 15, color, background);
+}
+
+// Pre-convert a whole ramp for the DMA push path
+void gaugeRampToRgb666(uint16_t color, uint16_t background, uint8_t* palette666) {
+  for (uint8_t i = 0; i < 16; i++) {
+    uint16_t c = gaugeRampColor(i, color, background);
+    rgb565ToRgb666Pixel((uint16_t)((c >> 8) | (c << 8)), palette666 + i * 3);
+  }
+}
+
+// Rebuild the coverage ramp for a new colour. Returns false if nothing changed.
+bool gaugeSpriteSetColor(GaugeSprite& gauge, uint16_t color, uint16_t background = TFT_BLACK) {
+  if (gauge.color == color && gauge.background == background) return false;
+  gauge.color = color;
+  gauge.background = background;
+  for (uint8_t i = 0; i < 16; i++) gauge.sprite->setPaletteColor(i, gaugeRampColor(i, color, background));
+  gaugeRampToRgb666(color, background, gauge.palette666);
+  return true;
+}
+
+// Width must be even so each row starts on a byte boundary
+void gaugeSpriteBegin(GaugeSprite& gauge, int16_t width, int16_t height, const uint8_t* font, uint8_t datum) {
+  if (gauge.sprite) return;
+  gauge.sprite = new TFT_eSprite(&display);
+  gauge.sprite->setColorDepth(4);
+  gauge.sprite->createSprite(width, height);
+  gauge.sprite->loadFont(font);
+  gauge.sprite->setTextDatum(datum);
+  gauge.sprite->setTextColor(GAUGE_INK, 0, true);
+  gauge.shown = INT32_MIN;
+  gauge.color = gauge.background = TFT_BLACK;  // forces the first palette build
+  gaugeSpriteSetColor(gauge, TFT_WHITE);
+}
+
+// Re-render the sprite as `value` with `decimals` implied places (147, 1 -> "14.7")
+void gaugeSpriteDrawValue(GaugeSprite& gauge, int32_t value, uint8_t decimals, int32_t x, int32_t y) {
+  char text[FORMAT_FIXED_MAX];
+  formatFixed(text, value, decimals);
+  gauge.sprite->fillSprite(0);
+  if (!gauge.digits || !digitCacheDraw(*gauge.digits, *gauge.sprite, text, x, y)) gauge.sprite->drawString(text, x, y);
+  gauge.shown = value;
+}
+
+struct GaugePushSource {
+  const uint8_t* pixels;
+  int32_t stride;  // bytes per row
+  const uint8_t* palette666;
+  int32_t first;   // first pixel of each row to push
+};
+
+static void dmaFillFromGauge(uint8_t* dst, int16_t line, int16_t lines, int16_t width, void* ctx) {
+  GaugePushSource* src = (GaugePushSource*)ctx;
+  for (int16_t l = 0; l < lines; l++) {
+    expand4bppToRgb666(src->pixels + (line + l) * src->stride, src->first, dst, width, src->palette666);
+    dst += width * 3;
+  }
+}
+
+#define GAUGE_INK_GAP 4  // a new window costs about as much as this many pixels
+
+typedef void (*GaugeInkRun)(int32_t row, int32_t start, int32_t length, void* ctx);
+
+// Call `run` for each run of pixels that aren't index 0 in a 4-bit image, row by row, in
+// screen columns: screen column i shows image column (first + i) % w. Gaps up to
+// GAUGE_INK_GAP are bridged, as a separate window would cost more than painting them.
+static void gaugeInkRuns(const uint8_t* pixels, int32_t w, int32_t h, int32_t first, GaugeInkRun run, void* ctx) {
+  for (int32_t row = 0; row < h; row++) {
+    const uint8_t* line = pixels + row * (w / 2);
+    int32_t runStart = -1, runEnd = -1;
+    int32_t c = first;
+    for (int32_t i = 0; i < w; i++, c++) {
+      if (c == w) c = 0;
+      uint8_t index = (c & 1) ? (line[c >> 1] & 0x0F) : (line[c >> 1] >> 4);
+      if (!index) continue;
+      if (runStart >= 0 && i - runEnd > GAUGE_INK_GAP) {
+        run(row, runStart, runEnd - runStart + 1, ctx);
+        runStart = -1;
+      }
+      if (runStart < 0) runStart = i;
+      runEnd = i;
+    }
+    if (runStart >= 0) run(row, runStart, runEnd - runStart + 1, ctx);
+  }
+}
+
+struct GaugeInkTarget {
+  int32_t x, y;
+  uint16_t color;
+  GaugePushSource src;
+};
+
+static void gaugeEraseRun(int32_t row, int32_t start, int32_t length, void* ctx) {
+  const GaugeInkTarget* t = (const GaugeInkTarget*)ctx;
+  display.fillRect(t->x + start, t->y + row, length, 1, t->color);
+}
+
+// Paint `color` over the ink of a 4-bit image shown at (x, y). Cheaper than clearing
+// the box when there is little ink.
+void gaugeEraseInk(const uint8_t* pixels, int32_t w, int32_t h, int32_t first, int32_t x, int32_t y,
+                   uint16_t color) {
+  dmaPushFlush();
+  GaugeInkTarget t = { x, y, color, {} };
+  gaugeInkRuns(pixels, w, h, first, gaugeEraseRun, &t);
+}
+
+static void gaugePushRun(int32_t row, int32_t start, int32_t length, void* ctx) {
+  GaugeInkTarget* t = (GaugeInkTarget*)ctx;
+  GaugePushSource src = t->src;
+  src.pixels += row * src.stride;
+  src.first = start;
+  pushWindowDMA(t->x + start, t->y + row, length, 1, dmaFillFromGauge, &src);
+}
+
+// Push only the ink of a 4-bit image, for when the screen underneath already shows palette entry 0
+void gaugePushInk(const uint8_t* pixels, int32_t w, int32_t h, int32_t x, int32_t y, const uint8_t* palette666) {
+  GaugeInkTarget t = { x, y, 0, { pixels, w / 2, palette666, 0 } };
+  gaugeInkRuns(pixels, w, h, 0, gaugePushRun, &t);
+}
+
+// Remove a gauge pushed at (x, y) from the screen, e.g. when its page goes away
+void gaugeSpriteErase(GaugeSprite& gauge, int32_t x, int32_t y) {
+  if (!gauge.sprite) return;
+  TFT_eSprite& s = *gauge.sprite;
+  gaugeEraseInk((const uint8_t*)s.getPointer(), s.width(), s.height(), 0, x, y, gauge.background);
+}
+
+void gaugeSpritePush(GaugeSprite& gauge, int32_t x, int32_t y) {
+  TFT_eSprite& s = *gauge.sprite;
+  bool onScreen = x >= 0 && y >= 0 && x + s.width() <= display.width() && y + s.height() <= display.height();
+  if (!dmaPushBuf[0] || !onScreen) {
+    dmaPushFlush();
+    s.pushSprite(x, y);  // the library expands through the same palette
+    return;
+  }
+  GaugePushSource src = { (const uint8_t*)s.getPointer(), s.width() / 2, gauge.palette666, 0 };
+  pushWindowDMA(x, y, s.width(), s.height(), dmaFillFromGauge, &src);
+}
+
+#endif
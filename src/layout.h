@@ -0,0 +1,235 @@
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+// Data-driven layout for the main page's value boxes.
+//
+// Each box is a packed LayoutWidget: which channel it shows, where, its
+// label and how it is coloured. The table is loaded once at boot from
+// /layout.bin on LittleFS (built from JSON by tools/layout_compile.py), with
+// the fast widgets sorted ahead of the lazy ones, so a frame is a walk over
+// one flat array and moving a box needs an uploadfs, not a reflash. If the
+// file is missing or fails validation the built-in table is used.
+//
+// File format, little endian:
+//   "MZL1", uint8 count, 3 reserved bytes, then `count` 24-byte records:
+//   uint8 channel, uint8 flags, uint8 color rule, uint8 reserved,
+//   int16 x, int16 y, uint16 color, uint16 label color, char label[12]
+//
+// The same checks are constexpr, so a built-in table is validated by the
+// compiler: a widget off screen or overlapping another fails the build.
+// Boxes may not cover the RPM bar, RPM readout or status row either, and a
+// label must be printable ASCII no wider than its box.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define LAYOUT_MAGIC "MZL1"
+#define LAYOUT_PATH "/layout.bin"
+#define LAYOUT_HEADER_BYTES 8
+#define LAYOUT_RECORD_BYTES 24
+#define LAYOUT_LABEL_LEN 12
+
+// Channels, in GaugeSlot order
+enum LayoutChannel { LAYOUT_AFR, LAYOUT_TPS, LAYOUT_ADV, LAYOUT_MAP, LAYOUT_IAT, LAYOUT_CLT, LAYOUT_BAT, LAYOUT_FPS, LAYOUT_CHANNELS };
+#define LAYOUT_MAX_WIDGETS LAYOUT_CHANNELS  // each channel at most once
+#define LAYOUT_MAX_BYTES (LAYOUT_HEADER_BYTES + LAYOUT_MAX_WIDGETS * LAYOUT_RECORD_BYTES)
+
+#define LAYOUT_LAZY 0x01           // redrawn once a second instead of every frame
+#define LAYOUT_DECIMALS_SHIFT 1    // value is in tenths when decimals is 1
+#define LAYOUT_DECIMALS_MASK 0x06
+#define LAYOUT_TENTHS (1 << LAYOUT_DECIMALS_SHIFT)
+
+// How a value picks its colour
+enum LayoutColorRule { LAYOUT_COLOR_FIXED, LAYOUT_COLOR_AFR, LAYOUT_COLOR_CLT, LAYOUT_COLOR_BAT, LAYOUT_COLOR_RULES };
+
+// A data box is 100 px wide: label at the top, 40 px value sprite 25 px down
+#define LAYOUT_SCREEN_W 480
+#define LAYOUT_SCREEN_H 320
+#define LAYOUT_BOX_W 100
+#define LAYOUT_BOX_H 65
+
+struct LayoutWidget {
+  uint8_t channel;
+  uint8_t flags;
+  uint8_t colorRule;
+  int16_t x, y;
+  uint16_t color;       // value colour for LAYOUT_COLOR_FIXED
+  uint16_t labelColor;
+  char label[LAYOUT_LABEL_LEN];
+};
+
+struct DashLayout {
+  uint8_t count;
+  uint8_t fastCount;  // widgets[0, fastCount) are drawn every frame, the rest are lazy
+  LayoutWidget widgets[LAYOUT_MAX_WIDGETS];
+};
+
+static constexpr uint8_t layoutDecimals(const LayoutWidget& w) {
+  return (w.flags & LAYOUT_DECIMALS_MASK) >> LAYOUT_DECIMALS_SHIFT;
+}
+
+static constexpr bool layoutBoxFits(const LayoutWidget& w) {
+  return w.x >= 0 && w.y >= 0 && w.x + LAYOUT_BOX_W <= LAYOUT_SCREEN_W && w.y + LAYOUT_BOX_H <= LAYOUT_SCREEN_H;
+}
+
+static constexpr bool layoutBoxesOverlap(const LayoutWidget& a, const LayoutWidget& b) {
+  return a.x < b.x + LAYOUT_BOX_W && b.x < a.x + LAYOUT_BOX_W && a.y < b.y + LAYOUT_BOX_H && b.y < a.y + LAYOUT_BOX_H;
+}
+
+// What the main page draws whatever the layout says. A box over any of these
+// would be painted over, and paint over it, every frame.
+struct LayoutRect {
+  int16_t x, y, w, h;
+};
+
+constexpr LayoutRect layoutReserved[] = {
+  { 120, 45, 240, 105 },  // RPM bar, drawRPMBarBlocks()
+  { 220, 120, 40, 18 },   // "RPM" label
+  { 190, 140, 100, 50 },  // RPM readout, drawRPMValue()
+  { 10, 285, 470, 30 },   // status row
+};
+
+static constexpr bool layoutBoxOnReserved(const LayoutWidget& w) {
+  for (const LayoutRect& r : layoutReserved) {
+    if (w.x < r.x + r.w && r.x < w.x + LAYOUT_BOX_W && w.y < r.y + r.h && r.y < w.y + LAYOUT_BOX_H) return true;
+  }
+  return false;
+}
+
+// Labels are drawn centred over the box in the small font (NotoSansBold15).
+// These are its advances for ' ' to '~', so a label can be measured without
+// the font loaded; like textWidth(), the last glyph counts its ink instead
+// where that reaches further, which for this font is one pixel more on the
+// characters in layoutLabelInkPastAdvance.
+constexpr uint8_t layoutLabelAdvance[95] = {
+  4, 4, 7, 10, 9, 14, 11, 4, 5, 5, 8, 9, 4, 5, 4, 6,
+  9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 4, 4, 9, 9, 9, 7,
+  13, 10, 10, 10, 11, 8, 8, 11, 11, 6, 5, 10, 8, 14, 12, 12,
+  9, 12, 10, 8, 9, 11, 10, 15, 10, 9, 9, 5, 6, 5, 9, 6,
+  5, 9, 10, 8, 10, 9, 6, 10, 10, 5, 5, 9, 5, 15, 10, 9,
+  10, 10, 7, 7, 7, 10, 9, 13, 9, 9, 7, 6, 8, 6, 9,
+};
+constexpr char layoutLabelInkPastAdvance[] = "&AY_fk";
+
+// Width of a label as drawn, or -1 if it has a character the font lacks
+static constexpr int16_t layoutLabelWidth(const char* label) {
+  int16_t width = 0;
+  for (uint8_t i = 0; i < LAYOUT_LABEL_LEN && label[i]; i++) {
+    char c = label[i];
+    if (c < ' ' || c > '~') return -1;
+    width += layoutLabelAdvance[c - ' '];
+    if (i + 1 < LAYOUT_LABEL_LEN && label[i + 1]) continue;
+    for (const char* p = layoutLabelInkPastAdvance; *p; p++) width += (*p == c);
+  }
+  return width;
+}
+
+// Channel, colour rule, decimals and label terminator are in range, and the
+// label fits across its box
+static constexpr bool layoutWidgetValid(const LayoutWidget& w) {
+  return w.channel < LAYOUT_CHANNELS && w.colorRule < LAYOUT_COLOR_RULES && layoutDecimals(w) <= 1 &&
+         w.label[LAYOUT_LABEL_LEN - 1] == '\0' && layoutLabelWidth(w.label) >= 0 &&
+         layoutLabelWidth(w.label) <= LAYOUT_BOX_W;
+}
+
+static inline uint16_t layoutRead16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+
+// Validate and unpack a layout file into `out`, fast widgets first. On failure
+// returns false and leaves `out` untouched.
+static inline bool layoutParse(const uint8_t* data, uint32_t len, DashLayout& out) {
+  if (len < LAYOUT_HEADER_BYTES || memcmp(data, LAYOUT_MAGIC, 4) != 0) return false;
+  uint8_t count = data[4];
+  if (count == 0 || count > LAYOUT_MAX_WIDGETS || len != LAYOUT_HEADER_BYTES + (uint32_t)count * LAYOUT_RECORD_BYTES) {
+    return false;
+  }
+
+  DashLayout parsed = {};
+  uint8_t seen = 0;
+  for (uint8_t pass = 0; pass < 2; pass++) {  // fast widgets, then lazy ones
+    const uint8_t* r = data + LAYOUT_HEADER_BYTES;
+    for (uint8_t i = 0; i < count; i++, r += LAYOUT_RECORD_BYTES) {
+      if ((r[1] & LAYOUT_LAZY) != pass) continue;
+      LayoutWidget w;
+      w.channel = r[0];
+      w.flags = r[1];
+      w.colorRule = r[2];
+      w.x = (int16_t)layoutRead16(r + 4);
+      w.y = (int16_t)layoutRead16(r + 6);
+      w.color = layoutRead16(r + 8);
+      w.labelColor = layoutRead16(r + 10);
+      memcpy(w.label, r + 12, LAYOUT_LABEL_LEN);
+      if (!layoutWidgetValid(w) || (seen & (1 << w.channel)) || !layoutBoxFits(w) || layoutBoxOnReserved(w)) {
+        return false;
+      }
+      for (uint8_t j = 0; j < parsed.count; j++) {
+        if (layoutBoxesOverlap(w, parsed.widgets[j])) return false;
+      }
+      seen |= 1 << w.channel;
+      parsed.widgets[parsed.count++] = w;
+      if (!pass) parsed.fastCount++;
+    }
+  }
+  out = parsed;
+  return true;
+}
+
+// Compile-time checks for a built-in table, one per static_assert so a
+// failed build says what is wrong
+
+template <size_t N>
+constexpr bool layoutTableFits(const LayoutWidget (&t)[N]) {
+  for (size_t i = 0; i < N; i++) {
+    if (!layoutBoxFits(t[i])) return false;
+  }
+  return true;
+}
+
+template <size_t N>
+constexpr bool layoutTableOverlaps(const LayoutWidget (&t)[N]) {
+  for (size_t i = 0; i < N; i++) {
+    for (size_t j = 0; j < i; j++) {
+      if (layoutBoxesOverlap(t[i], t[j])) return true;
+    }
+  }
+  return false;
+}
+
+template <size_t N>
+constexpr bool layoutTableOnReserved(const LayoutWidget (&t)[N]) {
+  for (size_t i = 0; i < N; i++) {
+    if (layoutBoxOnReserved(t[i])) return true;
+  }
+  return false;
+}
+
+template <size_t N>
+constexpr uint8_t layoutFastCount(const LayoutWidget (&t)[N]) {
+  uint8_t fast = 0;
+  while (fast < N && !(t[fast].flags & LAYOUT_LAZY)) fast++;
+  return fast;
+}
+
+// Each channel once, fields in range and fast widgets ahead of lazy ones
+template <size_t N>
+constexpr bool layoutTableValid(const LayoutWidget (&t)[N]) {
+  if (N == 0 || N > LAYOUT_MAX_WIDGETS) return false;
+  uint8_t seen = 0;
+  for (size_t i = 0; i < N; i++) {
+    if (!layoutWidgetValid(t[i]) || (seen & (1 << t[i].channel))) return false;
+    if (i >= layoutFastCount(t) && !(t[i].flags & LAYOUT_LAZY)) return false;
+    seen |= 1 << t[i].channel;
+  }
+  return true;
+}
+
+template <size_t N>
+constexpr DashLayout layoutFromTable(const LayoutWidget (&t)[N]) {
+  DashLayout layout = {};
+  layout.count = N;
+  layout.fastCount = layoutFastCount(t);
+  for (size_t i = 0; i < N; i++) layout.widgets[i] = t[i];
+  return layout;
+}
+
+#endif
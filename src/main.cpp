@@ -1,15 +1,16 @@
 #include <WiFi.h>
 #include <esp_wifi.h>
+#include <esp_system.h>
 #include <WebServer.h>
 #include <Update.h>
 #include <EEPROM.h>
+#include <LittleFS.h>
 #include <cstring>
 #include "Arduino.h"
 #include "SPI.h"
 #include <TFT_eSPI.h>
 #include "NotoSansBold15.h"
 #include "NotoSansBold36.h"
-#include "splash/splash_manager.h"
 
 #define AA_FONT_SMALL NotoSansBold15
 #define AA_FONT_LARGE NotoSansBold36
@@ -19,14 +20,15 @@ void handleRoot();
 void handleUpdate();
 void handleToggle();
 void handleSplash();
+void handleSplashUpload();
+void handleSplashImage();
 void handleDisplayMode();
 void handleInfo();
+void handleBoot();
+void handlePage();
+void handleUnits();
 void drawSplashScreenWithImage();
-void startUpDisplay();
-void drawData();
-void drawDataBox(int x, int y, const char* label, const int value, uint16_t labelColor, const int valueToCompare, const int decimal, bool setup);
-void itemDraw(bool setup);
-void forceRedrawFPSLabel();
+void loadDashboardLayout();
 
 const char* version = "0.1.1";
 
@@ -42,7 +44,16 @@ TFT_eSprite spr = TFT_eSprite(&display);
 
 #include "Comms.h"
 #include "text_utils.h"
+#include "dma_push.h"
+#include "splash/splash_manager.h"
+#include "render_profiler.h"
+#include "gauge_sprite.h"
 #include "drawing_utils.h"
+#include "dashboard.h"
+#include "pages.h"
+#include "render_bench.h"
+#include "boot_sequencer.h"
+#include "boot_profiler.h"
 
 #define UART_BAUD 115200
 // ESP32-C3 Supermini
@@ -63,50 +74,22 @@ uint32_t lastClientCheckTimeout = 0;
 uint32_t wifiTimeout = 30000;
 bool clientConnected = true;
 
-uint8_t iat = 0, clt = 0;
-uint8_t refreshRate = 0;
-unsigned int rpm = 6000, lastRpm;
-int mapData, tps, adv, fp;
-float bat = 0.0, afrConv = 0.0;
-bool syncStatus, fan, ase, wue, rev, launch, airCon, dfco;
-
-int lastIat = -1, lastClt = -1, lastTps = -1, lastAdv = -1, lastMapData = -1, lastFp = -1;
-float lastBat = -1, lastAfrConv = -1;
-unsigned int lastRefreshRate = -1;
-
 uint32_t startupTime;
-uint32_t lazyUpdateTime;
-uint16_t spr_width = 0;
 
+RTC_NOINIT_ATTR uint32_t bootWarmMarker;  // survives every reset but power-on; see boot_sequencer.h
+BootPath bootPath = BOOT_COLD;
+RTC_NOINIT_ATTR BootTimeline bootTimeline;  // this boot, still there after a reset; see boot_profiler.h
+BootTimeline lastBootTimeline;              // the boot before, copied out at the start of setup()
 
 
 
-void drawData() {
-  if (lastRpm != rpm) {
-    drawRPMBarBlocks(rpm);
-    spr.loadFont(AA_FONT_LARGE);
-    spr.createSprite(100, 50);
-    spr_width = spr.textWidth("7777");  // 7 is widest numeral in this font
-    spr.setTextColor(TFT_WHITE, TFT_BLACK, true);
-    spr.setTextDatum(TR_DATUM);
-    spr.drawNumber(rpm, 100, 5);
-    spr.pushSprite(190, 140);
-    spr.deleteSprite();
-    
-    // Redraw RPM label to ensure it's always visible
-    display.loadFont(AA_FONT_SMALL);
-    display.setTextColor(TFT_WHITE, TFT_BLACK);
-    display.setTextDatum(TC_DATUM);
-    display.drawString("RPM", 240, 120);
-    
-    lastRpm = rpm;
-  }
-  itemDraw(false);
-}
 
 void drawSplashScreenWithImage() {
   // Draw current selected splash screen dynamically
-  drawCurrentSplash(display, 0, 0, TFT_WHITE, TFT_BLACK);
+  {
+    RENDER_PROFILE(PROF_SPLASH);
+    drawCurrentSplash(display, 0, 0, TFT_WHITE, TFT_BLACK);
+  }
   
   // Add splash screen name and version info at the bottom
   display.loadFont(AA_FONT_SMALL);
@@ -121,8 +104,6 @@ void drawSplashScreenWithImage() {
   display.setTextColor(TFT_CYAN, TFT_BLACK);
   display.setTextDatum(TC_DATUM);
   display.drawString("www.mazduino.com", display.width() / 2, 5);
-  
-  delay(5000);
 }
 
 void handleUpdate() {
@@ -148,108 +129,9 @@ void handleUpdate() {
 
 
 
-void drawDataBox(int x, int y, const char* label, const int value, uint16_t labelColor, const int valueToCompare, const int decimal, bool setup) {
-  const int BOX_WIDTH = 100;  // Reduced width to fit screen
-  const int BOX_HEIGHT = 80;  // Adjusted height
-  const int LABEL_HEIGHT = BOX_HEIGHT / 2;
-
-  if (setup) {
-    spr.loadFont(AA_FONT_SMALL);
-    spr.createSprite(BOX_WIDTH, LABEL_HEIGHT);
-    spr.setTextColor(labelColor, TFT_BLACK, true);
-    spr.drawString(label, 50, 5);
-    spr.setTextDatum(TC_DATUM);
-    if (label == "AFR") {
-      spr.pushSprite(x - 10, y);
-    } else {
-      spr.pushSprite(x, y);
-    }
-  }
-  if (valueToCompare != value) {
-    spr.loadFont(AA_FONT_LARGE);
-    spr.createSprite(BOX_WIDTH, LABEL_HEIGHT);
-    spr.setTextDatum(TC_DATUM);
-    spr_width = spr.textWidth("333");
-    spr.setTextColor(labelColor, TFT_BLACK, true);
-    if (decimal > 0) {
-      spr.drawFloat((value / 10.0), decimal, 50, 5);
-    } else {
-      spr.drawNumber(value, 50, 5);
-    }
-    spr.pushSprite(x, y + LABEL_HEIGHT - 15);
-    spr.deleteSprite();
-  }
-}
-
-void itemDraw(bool setup) {
-  const char* labels[] = { "AFR", "TPS", "ADV", "MAP" };
-  int values[] = { afrConv, tps, adv, mapData };
-  int lastValues[] = { lastAfrConv, lastTps, lastAdv, lastMapData };
-  int positions[][2] = { { 5, 190 }, { 360, 190 }, { 120, 190 }, { 360, 10 } };
-  uint16_t colors[] = { (afrConv < 130) ? TFT_ORANGE : ((afrConv > 147) ? TFT_RED : TFT_GREEN), TFT_WHITE, TFT_RED, TFT_WHITE };
-
-  for (int v = 0; v < 4; v++) {
-    drawDataBox(positions[v][0], positions[v][1], labels[v], values[v], colors[v], lastValues[v], (v == 0) ? 1 : 0, setup);
-    lastValues[v] = values[v];
-  }
-
-  if ((millis() - lazyUpdateTime > 1000) || setup) {
-    const char* labelsLazy[4] = { "IAT", "Coolant", "Voltage", (EEPROM.read(0) == 1) ? "FPS" : "FP" };
-    int valuesLazy[4] = { iat, clt, static_cast<int>(bat), (EEPROM.read(0) == 1) ? refreshRate : fp };
-    int lastValuesLazy[4] = { lastIat, lastClt, static_cast<int>(lastBat), (EEPROM.read(0) == 1) ? lastRefreshRate : lastFp };
-
-    int positionsLazy[][2] = { { 5, 10 }, { 5, 100 }, { 360, 100 }, { 240, 190 } };
-    uint16_t colorsLazy[] = { TFT_WHITE, (clt > 95) ? TFT_RED : TFT_WHITE,
-                              ((bat < 115 || bat > 145) ? TFT_ORANGE : TFT_GREEN), TFT_WHITE };
-
-    for (int l = 0; l < 4; l++) {
-      drawDataBox(positionsLazy[l][0], positionsLazy[l][1], labelsLazy[l], valuesLazy[l], colorsLazy[l], lastValuesLazy[l], (l == 2) ? 1 : 0, setup);
-      lastValuesLazy[l] = valuesLazy[l];
-    }
 
-    lazyUpdateTime = millis();
-  }
-  // Center buttons
-  display.loadFont(AA_FONT_SMALL);
-  const char* buttonLabels[] = { "SYNC", "FAN", "ASE", "WUE", "REV", "LCH", "AC", "DFCO" };
-  bool buttonStates[] = { syncStatus, fan, ase, wue, rev, launch, airCon, dfco };
-  for (int i = 0; i < 8; i++) {
-    drawSmallButton((10 + 60 * i), 285, buttonLabels[i], buttonStates[i]);
-  }
-}
 
-void forceRedrawFPSLabel() {
-  // Force redraw just the FPS/FP label and value (position [3] in lazy array)
-  const char* label = (EEPROM.read(0) == 1) ? "FPS" : "FP";
-  int value = (EEPROM.read(0) == 1) ? refreshRate : fp;
-  
-  // Clear the label area first
-  display.fillRect(240, 190, 100, 80, TFT_BLACK);
-  
-  // Redraw the label and value
-  drawDataBox(240, 190, label, value, TFT_WHITE, -1, 0, true);  // Force setup=true to redraw label
-}
 
-void startUpDisplay() {
-  display.fillScreen(TFT_BLACK);
-  display.loadFont(AA_FONT_SMALL);
-  spr.setColorDepth(16);
-  display.setTextColor(TFT_WHITE, TFT_BLACK);
-  display.setTextDatum(TC_DATUM);  // Set text datum to top center
-  display.drawString("RPM", 240, 120);  // Center the label properly
-  itemDraw(true);
-  spr.loadFont(AA_FONT_LARGE);
-  for (int i = rpm; i >= 0; i -= 250) {
-    drawRPMBarBlocks(i);
-    spr.createSprite(100, 50);
-    spr_width = spr.textWidth("7777");  // 7 is widest numeral in this font
-    spr.setTextColor(TFT_WHITE, TFT_BLACK, true);
-    spr.setTextDatum(TR_DATUM);
-    spr.drawNumber(i, 100, 5);
-    spr.pushSprite(190, 140);
-    spr.deleteSprite();
-  }
-}
 const char* uploadPage PROGMEM = R"rawliteral(
 <!DOCTYPE html>
 <html>
@@ -350,10 +232,18 @@ const char* uploadPage PROGMEM = R"rawliteral(
     <h3>Splash Screen Selection</h3>
     <button class="btn" onclick="nextSplash()">Next Splash Screen</button>
     <p id="currentSplash">Current: Loading...</p>
+    <form method="POST" action="/splash/image" enctype="multipart/form-data">
+      <input type="file" name="splash" accept=".jpg,.jpeg,.bmp">
+      <input type="submit" class="btn" value="Upload Custom Splash">
+    </form>
+    <p>Baseline JPEG or 8/24-bit BMP, 480x320 draws fastest</p>
     <hr>
     <h3>Display Mode Control</h3>
     <button class="btn" id="displayModeBtn" onclick="toggleDisplayMode()">Switch to FP Mode</button>
     <p id="currentMode">Current: Loading...</p>
+    <h3>Page</h3>
+    <button class="btn" onclick="nextPage()">Next Page</button>
+    <p id="currentPage">Current: Loading...</p>
     <hr>
     <h3>Support & Documentation</h3>
     <p>For complete documentation, tutorials, and support:</p>
@@ -394,6 +284,16 @@ const char* uploadPage PROGMEM = R"rawliteral(
         });
       }
       
+      function showPage(data) {
+        document.getElementById('currentPage').textContent = 'Current: ' + data;
+      }
+
+      function nextPage() {
+        fetch('/page', { method: 'POST', body: 'next' })
+        .then(response => response.text())
+        .then(showPage);
+      }
+
       // Load current splash screen name on page load
       fetch('/splash', { method: 'GET' })
       .then(response => response.text())
@@ -401,6 +301,10 @@ const char* uploadPage PROGMEM = R"rawliteral(
         document.getElementById('currentSplash').textContent = 'Current: ' + data;
       });
       
+      fetch('/page', { method: 'GET' })
+      .then(response => response.text())
+      .then(showPage);
+
       // Load current display mode on page load
       fetch('/displaymode', { method: 'GET' })
       .then(response => response.text())
@@ -445,6 +349,45 @@ void handleSplash() {
   }
 }
 
+File splashUpload;
+bool splashUploadOk = false;
+
+// Streams the upload to LittleFS a chunk at a time; nothing is held in RAM
+void handleSplashUpload() {
+  HTTPUpload& upload = server.upload();
+  if (upload.status == UPLOAD_FILE_START) {
+    splashUploadOk = false;
+    if (splashFsReady()) {
+      splashUpload = LittleFS.open(SPLASH_FILE_UPLOAD, "w");
+      splashUploadOk = (bool)splashUpload;
+    }
+  } else if (upload.status == UPLOAD_FILE_WRITE) {
+    if (splashUploadOk && splashUpload.write(upload.buf, upload.currentSize) != upload.currentSize) {
+      splashUploadOk = false;  // file system full
+    }
+  } else if (upload.status == UPLOAD_FILE_END || upload.status == UPLOAD_FILE_ABORTED) {
+    if (splashUpload) splashUpload.close();
+    if (upload.status == UPLOAD_FILE_ABORTED) splashUploadOk = false;
+  }
+}
+
+// POST: install the uploaded image and select it. DELETE: remove it.
+void handleSplashImage() {
+  if (server.method() == HTTP_DELETE) {
+    splashFileRemove();
+    if (getCurrentSplashScreen() == SPLASH_CUSTOM) setSplashScreen(SPLASH_ZETTECH);
+    server.send(200, "text/plain", getSplashScreenName());
+    return;
+  }
+  if (!splashUploadOk || !splashFileInstall(SPLASH_FILE_UPLOAD)) {
+    if (splashFsReady()) LittleFS.remove(SPLASH_FILE_UPLOAD);
+    server.send(400, "text/plain", "Not a baseline JPEG or 8/24-bit BMP that fits 480x320, or no room for it");
+    return;
+  }
+  setSplashScreen(SPLASH_CUSTOM);
+  server.send(200, "text/plain", "Custom splash installed; shown from the next start");
+}
+
 void handleDisplayMode() {
   if (server.method() == HTTP_POST) {
     // Toggle display mode
@@ -453,8 +396,12 @@ void handleDisplayMode() {
     EEPROM.write(0, newMode);
     EEPROM.commit();
     
-    // Force immediate redraw of the FPS/FP label
-    forceRedrawFPSLabel();
+    // Force immediate redraw of the FPS/FP label, or just re-render it for when the main page comes back
+    if (activePage == PAGE_MAIN) {
+      forceRedrawFPSLabel();
+    } else {
+      buildDashboardBackground();
+    }
     
     // Also force redraw on next itemDraw call for consistency
     lazyUpdateTime = 0;
@@ -468,45 +415,127 @@ void handleDisplayMode() {
   }
 }
 
+void handlePage() {
+  if (server.method() == HTTP_POST) {
+    String body = server.arg("plain");
+    bool shown;
+    if (body.length() == 0 || body == "next") {
+      shown = pageShowNext();
+    } else {
+      PageId id = pageByName(body.c_str());
+      if (id == PAGE_COUNT) {
+        server.send(404, "text/plain", "Unknown page");
+        return;
+      }
+      shown = pageShow(id);
+    }
+    if (!shown) {
+      server.send(409, "text/plain", pages[activePage].name);
+      return;
+    }
+  }
+  server.send(200, "text/plain", pages[activePage].name);
+}
+
+// "clt=C iat=F map=kPa afr=lambda"
+String unitsText() {
+  String text;
+  for (uint8_t c = 0; c < UNIT_CHANNELS; c++) {
+    if (c) text += " ";
+    text += String(unitChannelName(c)) + "=" + unitName(c, displayUnits & UNIT_ALT(c));
+  }
+  return text;
+}
+
+// POST "<channel>=<unit>", e.g. "clt=F" or "afr=lambda"
+void handleUnits() {
+  if (server.method() == HTTP_POST) {
+    String body = server.arg("plain");
+    int eq = body.indexOf('=');
+    String channel = body.substring(0, eq), unit = body.substring(eq + 1);
+    uint8_t units = displayUnits;
+    bool known = false;
+    for (uint8_t c = 0; eq > 0 && c < UNIT_CHANNELS; c++) {
+      if (!channel.equalsIgnoreCase(unitChannelName(c))) continue;
+      for (uint8_t alt = 0; alt < 2; alt++) {
+        if (!unit.equalsIgnoreCase(unitName(c, alt))) continue;
+        units = alt ? (units | UNIT_ALT(c)) : (units & ~UNIT_ALT(c));
+        known = true;
+      }
+    }
+    if (!known) {
+      server.send(404, "text/plain", "Unknown channel or unit");
+      return;
+    }
+    if (units != displayUnits) {
+      saveDisplayUnits(units);
+      pages[activePage].draw(true);  // every box re-rendered in its new unit
+      dmaPushFlush();
+    }
+  }
+  server.send(200, "text/plain", unitsText());
+}
+
 void handleInfo() {
   String info = "Mazduino Display v" + String(version) + "\n";
   info += "Hardware: ESP32-C3 + ILI9488 3.5\" TFT\n";
   info += "Current Splash: " + String(getSplashScreenName()) + "\n";
+  info += "Custom Splash: " + String(splashFileExists() ? "installed" : "none") + "\n";
   info += "Display Mode: " + String((EEPROM.read(0) == 1) ? "FPS" : "FP") + "\n";
   info += "WiFi: " + String(WiFi.softAPgetStationNum()) + " clients connected\n";
   info += "Uptime: " + String(millis() / 1000) + " seconds\n";
+  info += "Last Boot: " + String((bootPath == BOOT_WARM) ? "warm restart, splash skipped" : "cold") + "\n";
   info += "Memory: " + String(ESP.getFreeHeap()) + " bytes free\n";
+  info += "Push: " + String(dmaPushStats.lastFrameBytes) + " bytes/frame, " +
+          String(dmaPushStats.avgFrameSavedUs) + " us/frame CPU returned by DMA\n";
+  info += "Units: " + unitsText() + "\n";
+  info += "Layout: " + String(dashLayoutLoaded ? LAYOUT_PATH : "built-in") + ", " + String(dashLayout.count) +
+          " widgets\n";
+  info += "Background: " + String(dashboardBackground.count) + " tiles, " +
+          String(backgroundBytes(dashboardBackground)) + " bytes compressed\n";
   info += "\nFor support and documentation visit:\n";
   info += "https://www.mazduino.com\n";
   
   server.send(200, "text/plain", info);
 }
 
-void handleRoot() {
-  server.send(200, "text/html", uploadPage);
+void handleBoot() {
+  char text[768];
+  bootTimelineFormat(bootTimeline, text, sizeof(text));
+  String body = "This boot (" + String((bootPath == BOOT_WARM) ? "warm" : "cold") + "):\n" + String(text);
+  bootTimelineFormat(lastBootTimeline, text, sizeof(text));
+  body += "\nPrevious boot:\n" + String(text);
+  server.send(200, "text/plain", body);
 }
 
-void setup() {
-  display.init();
-  display.setRotation(3);
-  
-  // Initialize EEPROM first
-  EEPROM.begin(EEPROM_SIZE);
-  
-  // Initialize splash screen manager
-  initSplashManager();
-  
-  // Draw the selected splash screen
-  drawSplashScreenWithImage();
-  display.fillScreen(TFT_BLACK);
+// Replace the built-in main page layout with /layout.bin when LittleFS holds a valid one
+void loadDashboardLayout() {
+#ifndef LAYOUT_COMPILE_TIME
+  if (!LittleFS.begin()) return;
+  File file = LittleFS.open(LAYOUT_PATH, "r");
+  if (!file) return;
+  uint8_t data[LAYOUT_MAX_BYTES];
+  size_t len = file.size();
+  if (len <= sizeof(data) && file.read(data, len) == len) dashLayoutLoaded = layoutParse(data, len, dashLayout);
+  file.close();
+#endif
+}
 
-  // Serial.begin(UART_BAUD);
-  Serial1.begin(UART_BAUD, SERIAL_8N1, RXD, TXD);
+void handleRoot() {
+  server.send(200, "text/html", uploadPage);
+}
 
+// Boot steps, run while the splash is on screen (see boot_sequencer.h)
+bool bootWifi() {
+  BootStageScope stage(bootTimeline, BOOT_STAGE_WIFI);
   WiFi.mode(WIFI_MODE_AP);
   WiFi.softAPConfig(ip, ip, netmask);
   WiFi.softAP(ssid, password);
+  esp_wifi_set_max_tx_power(34); // Set max WiFi power for ESP32-C3
+  return true;
+}
 
+void registerRoutes() {
   server.on("/", HTTP_GET, handleRoot);
   server.on(
     "/update", HTTP_POST, []() {
@@ -518,26 +547,155 @@ void setup() {
   server.on("/toggle", HTTP_POST, handleToggle);     // Endpoint untuk toggle
   server.on("/splash", HTTP_GET, handleSplash);      // Get current splash screen
   server.on("/splash", HTTP_POST, handleSplash);     // Switch to next splash screen
+  server.on("/splash/image", HTTP_POST, handleSplashImage, handleSplashUpload);  // Upload a custom splash
+  server.on("/splash/image", HTTP_DELETE, handleSplashImage);                    // Remove it
   server.on("/displaymode", HTTP_GET, handleDisplayMode);   // Get current display mode
   server.on("/displaymode", HTTP_POST, handleDisplayMode);  // Toggle display mode
+  server.on("/page", HTTP_GET, handlePage);          // Get current page
+  server.on("/page", HTTP_POST, handlePage);         // Switch to a page by name, or the next one
+  server.on("/units", HTTP_GET, handleUnits);        // Get display units per channel
+  server.on("/units", HTTP_POST, handleUnits);       // Set one channel's unit, e.g. "clt=F"
   server.on("/info", HTTP_GET, handleInfo);          // Get device information
+  server.on("/boot", HTTP_GET, handleBoot);          // Get the boot timeline
+}
 
+bool bootServer() {
+  BootStageScope stage(bootTimeline, BOOT_STAGE_SERVER);
+  registerRoutes();
   server.begin();
   // Serial.println("Web server aktif.");
-  esp_wifi_set_max_tx_power(34); // Set max WiFi power for ESP32-C3
+  return true;
+}
 
-  // Only set default EEPROM value if it's uninitialized (first boot)
-  // Check if EEPROM has been initialized by reading a marker at address 2
-  if (EEPROM.read(2) != 0xAA) {
-    // First boot - set default values
-    EEPROM.write(0, 1);  // Default to FPS mode
-    EEPROM.write(2, 0xAA); // Set initialization marker
-    EEPROM.commit();
+bool bootDashboard() {
+  BootStageScope stage(bootTimeline, BOOT_STAGE_DASHBOARD);
+  prepareDashboard();
+  return true;
+}
+
+// Resets that can happen with the engine running, as opposed to power-on or a restart after OTA
+bool resetWasUnexpected() {
+  switch (esp_reset_reason()) {
+    case ESP_RST_EXT:
+    case ESP_RST_PANIC:
+    case ESP_RST_INT_WDT:
+    case ESP_RST_TASK_WDT:
+    case ESP_RST_WDT:
+    case ESP_RST_BROWNOUT:
+      return true;
+    default:
+      return false;
   }
-  // If marker exists, keep existing display mode setting
-  
-  delay(500);
+}
+
+// One realtime request; a reply means live data is flowing
+bool bootProbeEcu() {
+  BootStageScope stage(bootTimeline, BOOT_STAGE_ECU_PROBE);
+  if (!requestData(BOOT_PROBE_TIMEOUT_MS)) return false;
+  rpmInterpolatorAdd(rpmInterp, getWord(14), millis());
+  return true;
+}
+
+const BootStep bootSteps[] = {
+  { "dashboard", bootDashboard },
+  { "wifi", bootWifi },
+  { "server", bootServer },
+};
+
+void setup() {
+  lastBootTimeline = bootTimeline;  // after a power-on this is noise, which bootTimelineValid() rejects
+  bootTimelineBegin(bootTimeline);
+
+  {
+    BootStageScope stage(bootTimeline, BOOT_STAGE_DISPLAY);
+    display.init();
+    display.setRotation(3);
+    initDmaPush();
+  }
+
+  {
+    BootStageScope stage(bootTimeline, BOOT_STAGE_EEPROM);
+    // Initialize EEPROM first
+    EEPROM.begin(EEPROM_SIZE);
+
+    // Only set default EEPROM value if it's uninitialized (first boot)
+    // Check if EEPROM has been initialized by reading a marker at address 2
+    if (EEPROM.read(2) != 0xAA) {
+      // First boot - set default values
+      EEPROM.write(0, 1);  // Default to FPS mode
+      EEPROM.write(2, 0xAA); // Set initialization marker
+      EEPROM.commit();
+    }
+    // If marker exists, keep existing display mode setting
+  }
+
+  {
+    BootStageScope stage(bootTimeline, BOOT_STAGE_SETTINGS);
+    loadDisplayUnits();
+    loadDashboardLayout();
+  }
+
+  // Serial.begin(UART_BAUD);
+  Serial1.begin(UART_BAUD, SERIAL_8N1, RXD, TXD);
+
+  // Ask the ECU first: a running engine means the gauges are needed now
+  bool ecuLive = bootProbeEcu();
+  rpm = ecuLive ? getWord(14) : 0;
+  bootPath = bootChoosePath(resetWasUnexpected(), bootWarmMarker, ecuLive, rpm);
+
+  if (bootPath == BOOT_WARM) {
+    // No splash, no sweep. WiFi stays off, as loop() would turn it off at this RPM anyway.
+    registerRoutes();
+    wifiActive = false;
+    BootStageScope stage(bootTimeline, BOOT_STAGE_START_UP);
+    startUpDisplay(false);
+  } else {
+    {
+      // Initialize splash screen manager
+      BootStageScope stage(bootTimeline, BOOT_STAGE_SPLASH_INIT);
+      initSplashManager();
+    }
+
+    {
+      // Draw the selected splash screen, then bring everything else up while it shows
+      BootStageScope stage(bootTimeline, BOOT_STAGE_SPLASH);
+      drawSplashScreenWithImage();
+    }
+
+    {
+      BootStageScope stage(bootTimeline, BOOT_STAGE_SEQUENCER);
+      BootSequencer boot;
+      bootBegin(boot, bootSteps, sizeof(bootSteps) / sizeof(bootSteps[0]), bootProbeEcu, millis());
+      while (!bootPoll(boot, millis())) {
+      }
+    }
+
+    // Sweep the bar down from full scale; the gaps between frames go to the ECU,
+    // so the first loop() already has samples to interpolate
+    BootStageScope stage(bootTimeline, BOOT_STAGE_START_UP);
+    startUpDisplayBegin();
+    StartupSweep sweep;
+    sweepBegin(sweep, 6000, millis());
+    while (!startUpSweepPoll(sweep, millis())) {
+      if (sweepSpareMs(sweep, millis()) > BOOT_PROBE_TIMEOUT_MS) bootProbeEcu();
+    }
+  }
+  bootTimelineEnd(bootTimeline, micros());
+#ifdef BOOT_PROFILE_SERIAL
+  // Bench builds only: UART0 shares the ECU pins on the Supermini
+  {
+    char text[768];
+    Serial.begin(UART_BAUD);
+    bootTimelineFormat(bootTimeline, text, sizeof(text));
+    Serial.print(text);
+  }
+#endif
+#ifdef RENDER_BENCH
+  // Bench builds only: UART0 shares the ECU pins on the Supermini
+  Serial.begin(UART_BAUD);
+  runRenderBench([](const char* line) { Serial.println(line); });
   startUpDisplay();
+#endif
   startupTime = millis();
   lazyUpdateTime = startupTime;
   lastClientCheckTimeout = startupTime;
@@ -546,7 +704,7 @@ void setup() {
 void loop() {
   static uint32_t lastUpdate = millis();
   if (millis() - lastUpdate > 10) {
-    requestData(50);
+    if (requestData(50)) rpmInterpolatorAdd(rpmInterp, getWord(14), millis());
     lastUpdate = millis();
   }
 
@@ -557,11 +715,12 @@ void loop() {
   if (lastRefresh - lazyUpdateTime > 100 || rpm < 100) {
     clt = getByte(7) - 40;
     iat = getByte(6) - 40;
-    bat = getByte(9);
+    bat = Tenths::fromRaw(getByte(9));
   }
   rpm = getWord(14);
+  bootWarmMarker = bootWarmMarkerFor(rpm);
   mapData = getWord(4);
-  afrConv = getByte(10);
+  afrConv = Tenths::fromRaw(getByte(10));
   tps = getByte(24) / 2;
   adv = (int8_t)getByte(23);
   fp = getByte(103);
@@ -574,7 +733,8 @@ void loop() {
   airCon = getByte(122);
   fan = getBit(106, 3);
   dfco = getBit(1, 4);
-  drawData();
+  recordHistory(millis());
+  drawPage();
 
   if (millis() - lastClientCheck >= 1000) {
     lastClientCheck = millis();
@@ -0,0 +1,248 @@
+#ifndef NEEDLE_GAUGE_H
+#define NEEDLE_GAUGE_H
+
+// Anti-aliased needle gauge with incremental updates.
+//
+// The dial (ticks, labels, hub) is rendered once into a 4-bit sprite using the
+// coverage-ramp palette from gauge_sprite.h. Moving the needle only pushes the
+// bounding box of the old and new needle: each line of that box is expanded
+// from the cached dial straight into the DMA line buffer and the needle is
+// blended on top there, with its coverage computed in Q8 fixed point from the
+// constexpr sine table. No full-dial redraw and no 16-bit work sprite - a
+// 200 px dial costs a few KB of SPI per update instead of 120 KB, which is
+// what keeps it above 60 updates a second at 20 MHz.
+
+#include <TFT_eSPI.h>
+#include "fixed_trig.h"
+#include "gauge_sprite.h"
+#include "dma_push.h"
+
+struct NeedleGaugeStyle {
+  int32_t minValue, maxValue;
+  int32_t majorStep;      // value between labelled ticks
+  uint8_t minorTicks;     // unlabelled ticks between two major ones
+  int32_t labelDivisor;   // major labels show value / labelDivisor, 0 for none
+  int16_t startAngle;     // TRIG_TURN units, clockwise from 12 o'clock
+  int16_t sweep;
+  uint16_t dialColor, needleColor;
+};
+
+// Region of the dial in dial coordinates, end exclusive
+struct NeedleBox {
+  int16_t x0, y0, x1, y1;
+};
+
+struct NeedleGauge {
+  const NeedleGaugeStyle* style;
+  int16_t x, y, size;  // dial is size x size at (x, y); size must be even
+  TFT_eSprite* dial;
+  uint8_t palette666[16 * 3];
+  uint8_t needle666[3];
+  int16_t angle;
+  NeedleBox shown;  // needle bounding box currently on screen
+  int32_t hubQ8, lengthQ8, halfWidthQ8;
+};
+
+// Coverage (0..256) of the pixel at (rx, ry) from the centre, all Q8, by a radial
+// stroke along (s, -c) from r0 to r1 with half width halfW
+static inline int32_t needleCoverage(int32_t rx, int32_t ry, int32_t s, int32_t c, int32_t r0, int32_t r1,
+                                     int32_t halfW) {
+  int32_t along = (rx * s - ry * c) >> 14;
+  int32_t across = (rx * c + ry * s) >> 14;
+  if (across < 0) across = -across;
+  int32_t cov = halfW + 128 - across;
+  int32_t tip = r1 + 128 - along;
+  int32_t base = along - r0 + 128;
+  if (tip < cov) cov = tip;
+  if (base < cov) cov = base;
+  if (cov <= 0) return 0;
+  return cov > 256 ? 256 : cov;
+}
+
+// Raise a dial pixel to at least `index` (strokes and labels overlap)
+static void needleDialPlot(NeedleGauge& g, int32_t x, int32_t y, uint8_t index) {
+  if (x < 0 || y < 0 || x >= g.size || y >= g.size) return;
+  uint8_t* p = (uint8_t*)g.dial->getPointer() + y * (g.size / 2) + (x >> 1);
+  uint8_t shift = (x & 1) ? 0 : 4;
+  uint8_t current = (*p >> shift) & 0x0F;
+  if (index > current) *p = (*p & ~(0x0F << shift)) | (index << shift);
+}
+
+static void needleDialStroke(NeedleGauge& g, int16_t angle, int32_t r0, int32_t r1, int32_t halfW) {
+  int32_t s = isin(angle), c = icos(angle);
+  int32_t centre = g.size << 7;
+  int32_t margin = (halfW >> 8) + 2;
+  int32_t ax = (centre + ((s * r0) >> 14)) >> 8, ay = (centre - ((c * r0) >> 14)) >> 8;
+  int32_t bx = (centre + ((s * r1) >> 14)) >> 8, by = (centre - ((c * r1) >> 14)) >> 8;
+  for (int32_t y = min(ay, by) - margin; y <= max(ay, by) + margin; y++) {
+    for (int32_t x = min(ax, bx) - margin; x <= max(ax, bx) + margin; x++) {
+      int32_t cov = needleCoverage((x << 8) + 128 - centre, (y << 8) + 128 - centre, s, c, r0, r1, halfW);
+      if (cov) needleDialPlot(g, x, y, (cov * GAUGE_INK) >> 8);
+    }
+  }
+}
+
+static void needleDialDisc(NeedleGauge& g, int32_t radiusQ8) {
+  int32_t centre = g.size << 7;
+  int32_t r = (radiusQ8 >> 8) + 2;
+  for (int32_t y = g.size / 2 - r; y <= g.size / 2 + r; y++) {
+    for (int32_t x = g.size / 2 - r; x <= g.size / 2 + r; x++) {
+      int32_t rx = (x << 8) + 128 - centre, ry = (y << 8) + 128 - centre;
+      int32_t cov = radiusQ8 + 128 - (int32_t)isqrt32(rx * rx + ry * ry);
+      if (cov > 0) needleDialPlot(g, x, y, ((cov > 256 ? 256 : cov) * GAUGE_INK) >> 8);
+    }
+  }
+}
+
+static int16_t needleAngleFor(const NeedleGauge& g, int32_t value) {
+  const NeedleGaugeStyle& st = *g.style;
+  value = constrain(value, st.minValue, st.maxValue);
+  return st.startAngle + (int32_t)st.sweep * (value - st.minValue) / (st.maxValue - st.minValue);
+}
+
+static NeedleBox needleBoxFor(const NeedleGauge& g, int16_t angle) {
+  int32_t s = isin(angle), c = icos(angle);
+  int32_t centre = g.size << 7;
+  int32_t ax = (centre + ((s * g.hubQ8) >> 14)) >> 8, ay = (centre - ((c * g.hubQ8) >> 14)) >> 8;
+  int32_t bx = (centre + ((s * g.lengthQ8) >> 14)) >> 8, by = (centre - ((c * g.lengthQ8) >> 14)) >> 8;
+  int32_t margin = (g.halfWidthQ8 >> 8) + 2;
+  NeedleBox b;
+  b.x0 = max((int32_t)0, min(ax, bx) - margin);
+  b.y0 = max((int32_t)0, min(ay, by) - margin);
+  b.x1 = min((int32_t)g.size, max(ax, bx) + margin + 1);
+  b.y1 = min((int32_t)g.size, max(ay, by) + margin + 1);
+  return b;
+}
+
+// Render the dial cache. Labels use `font` when the style asks for them.
+bool needleGaugeBegin(NeedleGauge& g, const NeedleGaugeStyle& style, int16_t x, int16_t y, int16_t size,
+                      const uint8_t* font) {
+  g.style = &style;
+  g.x = x;
+  g.y = y;
+  g.size = size;
+  g.dial = new TFT_eSprite(&display);
+  g.dial->setColorDepth(4);
+  if (!g.dial->createSprite(size, size)) {
+    delete g.dial;
+    g.dial = nullptr;
+    return false;
+  }
+  g.dial->fillSprite(0);
+  for (uint8_t i = 0; i < 16; i++) g.dial->setPaletteColor(i, gaugeRampColor(i, style.dialColor, TFT_BLACK));
+  gaugeRampToRgb666(style.dialColor, TFT_BLACK, g.palette666);
+  uint16_t n = style.needleColor;
+  rgb565ToRgb666Pixel((uint16_t)((n >> 8) | (n << 8)), g.needle666);
+
+  int32_t radius = (size / 2) << 8;
+  g.hubQ8 = (int32_t)max(4, size / 20) << 8;
+  g.lengthQ8 = radius - (4 << 8);
+  g.halfWidthQ8 = 384;  // 3 px wide
+
+  int32_t ticks = (style.maxValue - style.minValue) / style.majorStep * (style.minorTicks + 1);
+  for (int32_t k = 0; k <= ticks; k++) {
+    int16_t a = style.startAngle + (int32_t)style.sweep * k / ticks;
+    bool major = k % (style.minorTicks + 1) == 0;
+    needleDialStroke(g, a, radius - ((major ? 14 : 7) << 8), radius - (1 << 8), major ? 384 : 192);
+  }
+
+  if (style.labelDivisor && font) {
+    g.dial->loadFont(font);
+    g.dial->setTextDatum(MC_DATUM);
+    g.dial->setTextColor(GAUGE_INK, 0);
+    int32_t labelRadius = (size / 2) - 24;
+    for (int32_t v = style.minValue; v <= style.maxValue; v += style.majorStep) {
+      int16_t a = needleAngleFor(g, v);
+      g.dial->drawNumber(v / style.labelDivisor, size / 2 + ((isin(a) * labelRadius) >> 14),
+                         size / 2 - ((icos(a) * labelRadius) >> 14));
+    }
+    g.dial->unloadFont();
+  }
+  needleDialDisc(g, g.hubQ8);
+
+  g.angle = style.startAngle;
+  g.shown = needleBoxFor(g, g.angle);
+  return true;
+}
+
+void needleGaugeEnd(NeedleGauge& g) {
+  if (!g.dial) return;
+  g.dial->deleteSprite();
+  delete g.dial;
+  g.dial = nullptr;
+}
+
+// Remove the dial and needle from the screen; the dial cache is kept for the next draw
+void needleGaugeErase(NeedleGauge& g) {
+  if (!g.dial) return;
+  gaugeEraseInk((const uint8_t*)g.dial->getPointer(), g.size, g.size, 0, g.x, g.y, TFT_BLACK);
+  const NeedleBox& b = g.shown;
+  display.fillRect(g.x + b.x0, g.y + b.y0, b.x1 - b.x0, b.y1 - b.y0, TFT_BLACK);
+}
+
+struct NeedleFill {
+  const NeedleGauge* gauge;
+  int16_t bx, by;  // region origin in dial coordinates
+  int32_t s, c;
+};
+
+static void dmaFillFromNeedle(uint8_t* dst, int16_t line, int16_t lines, int16_t width, void* ctx) {
+  const NeedleFill* f = (const NeedleFill*)ctx;
+  const NeedleGauge& g = *f->gauge;
+  const uint8_t* pixels = (const uint8_t*)g.dial->getPointer();
+  int32_t centre = g.size << 7;
+  for (int16_t l = 0; l < lines; l++) {
+    int32_t y = f->by + line + l;
+    expand4bppToRgb666(pixels + y * (g.size / 2), f->bx, dst, width, g.palette666);
+    int32_t ry = (y << 8) + 128 - centre;
+    int32_t rx = (f->bx << 8) + 128 - centre;
+    uint8_t* p = dst;
+    for (int16_t i = 0; i < width; i++, rx += 256, p += 3) {
+      int32_t a = needleCoverage(rx, ry, f->s, f->c, g.hubQ8, g.lengthQ8, g.halfWidthQ8);
+      if (!a) continue;
+      for (uint8_t k = 0; k < 3; k++) p[k] = p[k] + (((g.needle666[k] - p[k]) * a) >> 8);
+    }
+    dst += width * 3;
+  }
+}
+
+static void needlePushBox(NeedleGauge& g, const NeedleBox& b) {
+  if (b.x1 <= b.x0 || b.y1 <= b.y0) return;
+  NeedleFill f = { &g, b.x0, b.y0, isin(g.angle), icos(g.angle) };
+  pushWindowDMA(g.x + b.x0, g.y + b.y0, b.x1 - b.x0, b.y1 - b.y0, dmaFillFromNeedle, &f);
+}
+
+// Push the whole dial with the needle at `value`
+void needleGaugeDraw(NeedleGauge& g, int32_t value) {
+  if (!g.dial || !dmaPushBuf[0]) return;
+  g.angle = needleAngleFor(g, value);
+  g.shown = needleBoxFor(g, g.angle);
+  NeedleBox all = { 0, 0, g.size, g.size };
+  needlePushBox(g, all);
+}
+
+// Move the needle, pushing only the strip it left and the strip it now covers.
+// Returns false if the needle did not move.
+bool needleGaugeSet(NeedleGauge& g, int32_t value) {
+  if (!g.dial || !dmaPushBuf[0]) return false;
+  int16_t angle = needleAngleFor(g, value);
+  if (angle == g.angle) return false;
+  g.angle = angle;
+  NeedleBox old = g.shown;
+  NeedleBox now = needleBoxFor(g, angle);
+  g.shown = now;
+
+  // One window when the boxes overlap enough, otherwise one each
+  NeedleBox both = { min(old.x0, now.x0), min(old.y0, now.y0), max(old.x1, now.x1), max(old.y1, now.y1) };
+  int32_t areaBoth = (int32_t)(both.x1 - both.x0) * (both.y1 - both.y0);
+  int32_t areaSplit = (int32_t)(old.x1 - old.x0) * (old.y1 - old.y0) + (int32_t)(now.x1 - now.x0) * (now.y1 - now.y0);
+  if (areaBoth <= areaSplit) {
+    needlePushBox(g, both);
+  } else {
+    needlePushBox(g, old);
+    needlePushBox(g, now);
+  }
+  return true;
+}
+
+#endif
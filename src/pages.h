@@ -0,0 +1,266 @@
+#ifndef PAGES_H
+#define PAGES_H
+
+// Dashboard pages and switching between them.
+//
+// Each page has its static labels as a compressed Background, built the first
+// time the page is shown and kept, plus three hooks: enter (set up widget
+// caches), draw (one frame, `dirty` forcing every widget out) and erase. A
+// switch never clears the screen: the old page paints out only its own ink -
+// gauge digits, dial ticks, chart traces and label tiles, run by run from
+// their cached sprites - then the new page blits its tiles and draws dirty.
+// That keeps a switch well under 100 ms of SPI at 20 MHz where a fillScreen()
+// alone would be 184 ms. Only the active page is ever drawn, so inactive
+// pages cost nothing per frame; the history rings keep filling regardless.
+// The status row is shared by every page except the full-screen trend page.
+
+#include "dashboard.h"
+#include "needle_gauge.h"
+#include "strip_chart.h"
+#include "trend_page.h"
+
+enum PageId { PAGE_MAIN, PAGE_TEMPS, PAGE_FUEL, PAGE_DIAG, PAGE_TREND, PAGE_COUNT };
+
+struct Page {
+  const char* name;
+  Background* background;
+  void (*build)(Background& bg);  // static labels, rendered on first visit
+  bool (*enter)();                // false if the page can't be shown
+  void (*draw)(bool dirty);
+  void (*erase)();                // paint out what draw() put on screen
+  bool statusRow;
+};
+
+// A value box on one of the secondary pages: label tile above, gauge sprite below
+struct PageBox {
+  const char* label;
+  int16_t x, y;
+  uint8_t decimals;
+};
+
+static void pageAddBoxLabels(Background& bg, const PageBox* boxes, uint8_t count) {
+  for (uint8_t i = 0; i < count; i++) {
+    backgroundAddText(bg, boxes[i].label, boxes[i].x + 50, boxes[i].y + 5, TC_DATUM, TFT_WHITE, AA_FONT_SMALL);
+  }
+}
+
+static void pageDrawBox(GaugeSprite& gauge, const PageBox& box, int value, uint16_t color, bool dirty) {
+  drawDataBox(gauge, box.x, box.y, value, color, box.decimals, dirty);
+}
+
+// A box showing a layout channel, in its display unit
+static void pageDrawChannelBox(GaugeSprite& gauge, const PageBox& box, uint8_t channel, int value, uint16_t color,
+                               bool dirty) {
+  ShownValue shown = channelShown(channel, value, box.decimals);
+  drawDataBox(gauge, box.x, box.y, shown.value, color, shown.decimals, dirty);
+}
+
+// Main: the original gauge page
+
+static bool mainPageEnter() { return true; }
+
+static void mainPageBuild(Background& bg) {
+  (void)bg;
+  buildDashboardBackground();
+}
+
+// Temperatures: coolant and intake dials with their readings, battery voltage
+
+#define TEMP_DIAL_SIZE 130
+const NeedleGaugeStyle tempDialStyle = { 0, 120, 20, 1, 1, -384, 768, TFT_WHITE, TFT_RED };
+const PageBox tempBoxes[] = { { "", 55, 175, 0 }, { "", 325, 175, 0 }, { "Voltage", 190, 175, 1 } };
+NeedleGauge cltDial, iatDial;
+GaugeSprite tempGauges[3];
+
+static void tempsPageBuild(Background& bg) {
+  backgroundClear(bg, TFT_BLACK);
+  backgroundAddText(bg, "Coolant", 40 + TEMP_DIAL_SIZE / 2, 10, TC_DATUM, TFT_WHITE, AA_FONT_SMALL);
+  backgroundAddText(bg, "Intake", 310 + TEMP_DIAL_SIZE / 2, 10, TC_DATUM, TFT_WHITE, AA_FONT_SMALL);
+  pageAddBoxLabels(bg, tempBoxes + 2, 1);
+}
+
+static bool tempsPageEnter() {
+  if (!cltDial.dial) needleGaugeBegin(cltDial, tempDialStyle, 40, 35, TEMP_DIAL_SIZE, AA_FONT_SMALL);
+  if (!iatDial.dial) needleGaugeBegin(iatDial, tempDialStyle, 310, 35, TEMP_DIAL_SIZE, AA_FONT_SMALL);
+  return cltDial.dial && iatDial.dial;
+}
+
+static void tempsPageDraw(bool dirty) {
+  int coolant = gaugeValue(GAUGE_CLT, clt, dirty);
+  int intake = gaugeValue(GAUGE_IAT, iat, dirty);
+  int voltage = gaugeValue(GAUGE_BAT, bat.raw, dirty);
+  if (dirty) {
+    needleGaugeDraw(cltDial, coolant);
+    needleGaugeDraw(iatDial, intake);
+  } else {
+    needleGaugeSet(cltDial, coolant);
+    needleGaugeSet(iatDial, intake);
+  }
+  pageDrawChannelBox(tempGauges[0], tempBoxes[0], LAYOUT_CLT, coolant, cltColor(coolant), dirty);
+  pageDrawChannelBox(tempGauges[1], tempBoxes[1], LAYOUT_IAT, intake, TFT_WHITE, dirty);
+  pageDrawBox(tempGauges[2], tempBoxes[2], voltage, batColor(Tenths::fromRaw(voltage)), dirty);
+}
+
+static void tempsPageErase() {
+  needleGaugeErase(cltDial);
+  needleGaugeErase(iatDial);
+  for (uint8_t i = 0; i < 3; i++) eraseDataBox(tempGauges[i], tempBoxes[i].x, tempBoxes[i].y);
+}
+
+// Fuel: AFR and MAP history with the current readings and fuel pressure
+
+#define FUEL_CHART_W 200  // 20 s of history
+#define FUEL_CHART_H 80
+const PageBox fuelBoxes[] = { { "AFR", 260, 20, 1 }, { "MAP", 260, 160, 0 }, { "Fuel P", 370, 90, 0 } };
+StripChart afrChart, mapChart;
+GaugeSprite fuelGauges[3];
+
+static void fuelPageBuild(Background& bg) {
+  backgroundClear(bg, TFT_BLACK);
+  pageAddBoxLabels(bg, fuelBoxes, 3);
+}
+
+static bool fuelPageEnter() {
+  if (!afrChart.sprite) {
+    stripChartBegin(afrChart, afrHistory, 10, 30, FUEL_CHART_W, FUEL_CHART_H, 100, 200, 20, TFT_GREEN);
+    stripChartBegin(mapChart, mapHistory, 10, 170, FUEL_CHART_W, FUEL_CHART_H, 0, 250, 50, TFT_CYAN);
+  } else {
+    stripChartRedraw(afrChart);
+    stripChartRedraw(mapChart);
+  }
+  return afrChart.sprite && mapChart.sprite;
+}
+
+static void fuelPageDraw(bool dirty) {
+  stripChartUpdate(afrChart);
+  stripChartUpdate(mapChart);
+  int afr = gaugeValue(GAUGE_AFR, afrConv.raw, dirty);
+  pageDrawChannelBox(fuelGauges[0], fuelBoxes[0], LAYOUT_AFR, afr, afrColor(Tenths::fromRaw(afr)), dirty);
+  pageDrawChannelBox(fuelGauges[1], fuelBoxes[1], LAYOUT_MAP, gaugeValue(GAUGE_MAP, mapData, dirty), TFT_WHITE, dirty);
+  pageDrawBox(fuelGauges[2], fuelBoxes[2], fp, TFT_WHITE, dirty);
+}
+
+static void fuelPageErase() {
+  stripChartErase(afrChart);
+  stripChartErase(mapChart);
+  for (uint8_t i = 0; i < 3; i++) eraseDataBox(fuelGauges[i], fuelBoxes[i].x, fuelBoxes[i].y);
+}
+
+// Diagnostics: how the display itself is doing, refreshed once a second
+
+const PageBox diagBoxes[] = { { "Loop FPS", 70, 30, 0 }, { "KB/frame", 310, 30, 1 },
+                              { "DMA saved us", 70, 160, 0 }, { "Uptime min", 310, 160, 0 } };
+GaugeSprite diagGauges[4];
+uint32_t diagUpdateTime;
+
+static void diagPageBuild(Background& bg) {
+  backgroundClear(bg, TFT_BLACK);
+  pageAddBoxLabels(bg, diagBoxes, 4);
+}
+
+static bool diagPageEnter() { return true; }
+
+static void diagPageDraw(bool dirty) {
+  if (!dirty && millis() - diagUpdateTime < 1000) return;
+  diagUpdateTime = millis();
+  int values[4] = { refreshRate, (int)(dmaPushStats.lastFrameBytes * 10 / 1024), (int)dmaPushStats.avgFrameSavedUs,
+                    (int)(millis() / 60000) };
+  for (uint8_t i = 0; i < 4; i++) pageDrawBox(diagGauges[i], diagBoxes[i], values[i], TFT_WHITE, dirty);
+}
+
+static void diagPageErase() {
+  for (uint8_t i = 0; i < 4; i++) eraseDataBox(diagGauges[i], diagBoxes[i].x, diagBoxes[i].y);
+}
+
+// Trend: full-screen hardware-scrolled traces, sampled at the history rate
+
+const TrendChannel trendChannels[TREND_CHANNELS] = {
+  { "RPM", 0, 7000, 2000, 0, TFT_YELLOW },
+  { "MAP", 0, 250, 100, 0, TFT_CYAN },
+  { "AFR", 100, 200, 25, 1, TFT_GREEN },
+  { "TPS", 0, 100, 50, 0, TFT_ORANGE },
+};
+TrendPage trendPage;
+
+static void trendPageBuild(Background& bg) { backgroundClear(bg, TFT_BLACK); }
+
+static bool trendPageEnter() { return trendPageBegin(trendPage, trendChannels); }
+
+static void trendPageDraw(bool dirty) {
+  (void)dirty;  // the plot starts empty
+  static uint32_t lastSample;
+  if (millis() - lastSample < HISTORY_INTERVAL_MS) return;
+  lastSample = millis();
+  int16_t values[TREND_CHANNELS] = { (int16_t)rpm, (int16_t)mapData, (int16_t)afrConv.raw, (int16_t)tps };
+  trendPageSample(trendPage, values);
+}
+
+static void trendPageErase() { trendPageEnd(trendPage); }
+
+Background pageBackgrounds[PAGE_COUNT];
+
+const Page pages[PAGE_COUNT] = {
+  { "Main", &dashboardBackground, mainPageBuild, mainPageEnter, drawMainPage, eraseMainPage, true },
+  { "Temperatures", &pageBackgrounds[PAGE_TEMPS], tempsPageBuild, tempsPageEnter, tempsPageDraw, tempsPageErase, true },
+  { "Fuel", &pageBackgrounds[PAGE_FUEL], fuelPageBuild, fuelPageEnter, fuelPageDraw, fuelPageErase, true },
+  { "Diagnostics", &pageBackgrounds[PAGE_DIAG], diagPageBuild, diagPageEnter, diagPageDraw, diagPageErase, true },
+  { "Trend", &pageBackgrounds[PAGE_TREND], trendPageBuild, trendPageEnter, trendPageDraw, trendPageErase, false },
+};
+
+PageId activePage = PAGE_MAIN;  // startUpDisplay() draws the main page
+
+// Switch pages. Returns false, staying on the current page, if `id` can't be shown.
+bool pageShow(PageId id) {
+  if (id == activePage || id >= PAGE_COUNT) return id == activePage;
+  RENDER_PROFILE(PROF_PAGE_SWITCH);
+  const Page& from = pages[activePage];
+  const Page& to = pages[id];
+  dmaPushFlush();
+
+  from.erase();
+  backgroundErase(*from.background);
+  if (from.statusRow && !to.statusRow) statusRowErase();
+
+  if (!to.enter()) {
+    // Put the old page back as it was
+    from.enter();
+    backgroundBlitTiles(*from.background);
+    from.draw(true);
+    if (from.statusRow) statusRowDraw(statusFlags());
+    dmaPushFlush();
+    return false;
+  }
+  if (!to.background->count) to.build(*to.background);
+  backgroundBlitTiles(*to.background);
+  activePage = id;
+  to.draw(true);
+  if (to.statusRow) statusRowDraw(statusFlags());
+  dmaPushFlush();
+  return true;
+}
+
+bool pageShowNext() {
+  for (uint8_t step = 1; step < PAGE_COUNT; step++) {
+    if (pageShow((PageId)((activePage + step) % PAGE_COUNT))) return true;
+  }
+  return false;
+}
+
+// Page by name, case-insensitive; PAGE_COUNT if there is none
+PageId pageByName(const char* name) {
+  for (uint8_t i = 0; i < PAGE_COUNT; i++) {
+    if (strcasecmp(pages[i].name, name) == 0) return (PageId)i;
+  }
+  return PAGE_COUNT;
+}
+
+// One frame of the active page
+void drawPage() {
+  RENDER_PROFILE(PROF_FRAME);
+  const Page& page = pages[activePage];
+  page.draw(false);
+  if (page.statusRow) statusRowDraw(statusFlags());
+  dmaPushEndFrame();
+}
+
+#endif
@@ -0,0 +1,247 @@
+#ifndef RENDER_BENCH_H
+#define RENDER_BENCH_H
+
+// Scripted render benchmark for the dashboard pages.
+//
+// Each scenario drives the engine globals frame by frame and calls drawData()
+// exactly like loop() does, then reports time, pixels and SPI bytes per frame
+// plus the per-widget breakdown collected by RENDER_PROFILE. The same code
+// runs on the host backend (test/native/test_render_bench), where traffic is
+// exact, and on the device with -D RENDER_BENCH, where time comes from the
+// cycle counter and traffic covers what goes through the DMA push path.
+// Judge every render change by these numbers.
+
+#include "render_profiler.h"
+#include "dashboard.h"
+#include "pages.h"
+#include "splash/splash_manager.h"
+
+#ifdef RENDER_PROFILE_ENABLED
+
+#define BENCH_FRAME_US 20000  // simulated frame period on the host clock
+
+typedef void (*BenchWriter)(const char* line);
+
+struct BenchScenario {
+  const char* name;
+  uint16_t frames;
+  void (*step)(uint16_t frame);
+};
+
+struct BenchResult {
+  uint32_t frames;
+  uint64_t ticks;
+  uint64_t pixels;
+  uint64_t bytes;
+};
+
+static uint32_t benchSeed;
+
+// Small deterministic jitter so runs are comparable between builds
+static int benchJitter(int range) {
+  benchSeed = benchSeed * 1103515245u + 12345u;
+  return (int)((benchSeed >> 16) % (2 * range + 1)) - range;
+}
+
+static void benchSetFlags(uint8_t bits) {
+  syncStatus = bits & 0x01;
+  fan = bits & 0x02;
+  ase = bits & 0x04;
+  wue = bits & 0x08;
+  rev = bits & 0x10;
+  launch = bits & 0x20;
+  airCon = bits & 0x40;
+  dfco = bits & 0x80;
+}
+
+static void benchIdleState() {
+  rpm = 850;
+  mapData = 35;
+  tps = 0;
+  adv = 12;
+  afrConv = Tenths::fromRaw(147);
+  iat = 30;
+  clt = 88;
+  bat = Tenths::fromRaw(138);
+  fp = 300;
+  refreshRate = 50;
+  benchSetFlags(0x01);
+}
+
+// Warm idle, nothing moving
+static void benchIdle(uint16_t frame) {
+  (void)frame;
+  benchIdleState();
+}
+
+// Steady road load with sensor noise on the fast channels
+static void benchCruise(uint16_t frame) {
+  (void)frame;
+  rpm = 2500 + benchJitter(40);
+  mapData = 60 + benchJitter(2);
+  tps = 18 + benchJitter(1);
+  adv = 28 + benchJitter(1);
+  afrConv = Tenths::fromRaw(147 + benchJitter(3));
+  refreshRate = 48 + benchJitter(2);
+}
+
+// Idle to the limiter and back, 100 rpm per frame
+static void benchSweep(uint16_t frame) {
+  int up = frame % 120;
+  rpm = (up <= 60) ? up * 100 : (120 - up) * 100;
+  tps = rpm / 60;
+  mapData = 30 + rpm / 90;
+  afrConv = Tenths::fromRaw((rpm > 4000) ? 125 : 147);
+  rev = rpm >= 6000;
+}
+
+// Every status button changes state at least once, one flag per frame
+static void benchFlags(uint16_t frame) {
+  benchIdleState();
+  benchSetFlags(frame ^ (frame >> 1));  // Gray code: one bit flips per frame
+}
+
+const BenchScenario benchScenarios[] = {
+  { "idle", 200, benchIdle },
+  { "cruise", 200, benchCruise },
+  { "rpm sweep", 240, benchSweep },
+  { "status flags", 256, benchFlags },
+};
+
+// On the host the scenarios run on simulated time only, so what they draw,
+// and the byte counts, don't depend on how fast the host is
+static void benchClockBegin() {
+#ifdef HOST_DISPLAY
+  hostClockSimulated(true);
+#endif
+}
+
+static void benchFrameTick() {
+#ifdef HOST_DISPLAY
+  hostAdvanceMicros(BENCH_FRAME_US);
+#endif
+}
+
+static void benchReportWidgets(BenchWriter out, uint32_t frames) {
+  char line[96];
+  for (uint8_t i = 0; i < PROF_COUNT; i++) {
+    const RenderProfileEntry& e = renderProfile[i];
+    if (i == PROF_FRAME || e.calls == 0) continue;
+    snprintf(line, sizeof(line), "  %-16s %6lu calls %8.1f us/call %8.1f px/frame %9.1f B/frame", renderProfileNames[i],
+             (unsigned long)e.calls, (double)e.ticks / PROFILER_TICKS_PER_US / e.calls,
+             (double)e.pixels / frames, (double)e.bytes / frames);
+    out(line);
+  }
+}
+
+BenchResult runBenchScenario(const BenchScenario& scenario, BenchWriter out) {
+  benchClockBegin();
+  benchSeed = 1;
+  benchIdleState();
+  rpmInterpolatorReset(rpmInterp);
+  drawData();  // settle from whatever the previous scenario left on screen
+  dmaPushFlush();
+  resetRenderProfile();
+
+  // Like loop(): every frame brings a fresh ECU sample
+  for (uint16_t f = 0; f < scenario.frames; f++) {
+    scenario.step(f);
+    rpmInterpolatorAdd(rpmInterp, rpm, millis());
+    drawData();
+    benchFrameTick();
+  }
+  dmaPushFlush();
+
+  const RenderProfileEntry& frame = renderProfile[PROF_FRAME];
+  BenchResult result = { frame.calls, frame.ticks, frame.pixels, frame.bytes };
+  if (out) {
+    char line[96];
+    snprintf(line, sizeof(line), "%-12s %4lu frames %8.1f us/frame %8.1f px/frame %9.1f B/frame", scenario.name,
+             (unsigned long)result.frames, (double)result.ticks / PROFILER_TICKS_PER_US / result.frames,
+             (double)result.pixels / result.frames, (double)result.bytes / result.frames);
+    out(line);
+    benchReportWidgets(out, result.frames);
+  }
+  return result;
+}
+
+// Full-screen cost of each splash image, drawn once
+BenchResult runBenchSplash(BenchWriter out) {
+  benchClockBegin();
+  BenchResult total = {};
+  char line[96];
+  for (uint8_t i = 0; i < SPLASH_CUSTOM; i++) {
+    resetRenderProfile();
+    {
+      RENDER_PROFILE(PROF_SPLASH);
+      drawSplash(display, (SplashType)i, 0, 0, TFT_WHITE, TFT_BLACK);
+    }
+    const RenderProfileEntry& e = renderProfile[PROF_SPLASH];
+    if (out) {
+      snprintf(line, sizeof(line), "splash %-15s %9.1f us %8lu px %9lu B", getSplashScreenName((SplashType)i),
+               (double)e.ticks / PROFILER_TICKS_PER_US, (unsigned long)e.pixels, (unsigned long)e.bytes);
+      out(line);
+    }
+    total.frames++;
+    total.ticks += e.ticks;
+    total.pixels += e.pixels;
+    total.bytes += e.bytes;
+  }
+  display.fillScreen(TFT_BLACK);
+  return total;
+}
+
+// Every switch between two pages, each from a settled page with full history charts.
+// Ends back on the main page.
+BenchResult runBenchPages(BenchWriter out) {
+  benchClockBegin();
+  BenchResult total = {};
+  char line[96];
+  benchSeed = 1;
+  benchIdleState();
+  recordHistory(millis());  // allocates the rings
+  for (uint16_t i = 0; i < HISTORY_SAMPLES; i++) {
+    chartRingPush(afrHistory, 147 + benchJitter(15));
+    chartRingPush(mapHistory, 35 + benchJitter(20));
+  }
+  for (uint8_t from = 0; from < PAGE_COUNT; from++) {
+    for (uint8_t to = 0; to < PAGE_COUNT; to++) {
+      if (from == to || !pageShow((PageId)from)) continue;
+      drawPage();
+      for (uint16_t i = 0; from == PAGE_TREND && i < TREND_PLOT_W; i++) {
+        int16_t values[TREND_CHANNELS] = { (int16_t)(2500 + benchJitter(400)), (int16_t)(60 + benchJitter(10)),
+                                           (int16_t)(147 + benchJitter(5)), (int16_t)(18 + benchJitter(3)) };
+        trendPageSample(trendPage, values);  // a full plot to paint out
+      }
+      dmaPushFlush();
+      resetRenderProfile();
+      if (!pageShow((PageId)to)) continue;
+      const RenderProfileEntry& e = renderProfile[PROF_PAGE_SWITCH];
+      if (out) {
+        snprintf(line, sizeof(line), "page %-12s -> %-12s %9.1f us %8lu px %9lu B %6.1f ms wire", pages[from].name,
+                 pages[to].name, (double)e.ticks / PROFILER_TICKS_PER_US, (unsigned long)e.pixels,
+                 (unsigned long)e.bytes, dmaWireTimeUs(e.bytes) / 1000.0);
+        out(line);
+      }
+      total.frames++;
+      total.ticks += e.ticks;
+      total.pixels += e.pixels;
+      total.bytes += e.bytes;
+    }
+  }
+  pageShow(PAGE_MAIN);
+  return total;
+}
+
+// Everything, starting from a freshly drawn gauge page
+void runRenderBench(BenchWriter out) {
+  benchClockBegin();
+  runBenchSplash(out);
+  startUpDisplay();
+  for (const BenchScenario& s : benchScenarios) runBenchScenario(s, out);
+  runBenchPages(out);
+}
+
+#endif
+
+#endif
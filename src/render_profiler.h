@@ -0,0 +1,83 @@
+#ifndef RENDER_PROFILER_H
+#define RENDER_PROFILER_H
+
+// Per-widget render cost accounting.
+//
+// RENDER_PROFILE(id) at the top of a drawing function charges the time spent
+// in it, and the pixels and SPI bytes it produced, to `id`. On the device time
+// comes from the CPU cycle counter and traffic from the DMA push statistics;
+// on the host backend both come from the instrumented display. Compiled out
+// unless RENDER_PROFILE_ENABLED (or RENDER_BENCH) is defined.
+
+#if defined(RENDER_BENCH) && !defined(RENDER_PROFILE_ENABLED)
+#define RENDER_PROFILE_ENABLED
+#endif
+
+enum RenderProfileId {
+  PROF_FRAME,
+  PROF_RPM_BAR,
+  PROF_RPM_VALUE,
+  PROF_DATA_BOX,
+  PROF_BUTTON,
+  PROF_SPLASH,
+  PROF_PAGE_SWITCH,
+  PROF_COUNT
+};
+
+const char* const renderProfileNames[PROF_COUNT] = {
+  "frame", "drawRPMBarBlocks", "drawRPMValue", "drawDataBox", "statusButton", "splash", "pageSwitch"
+};
+
+#ifdef RENDER_PROFILE_ENABLED
+
+struct RenderProfileEntry {
+  uint32_t calls;
+  uint64_t ticks;
+  uint64_t pixels;
+  uint64_t bytes;
+};
+
+RenderProfileEntry renderProfile[PROF_COUNT];
+
+#if defined(HOST_DISPLAY)
+#define PROFILER_TICKS_PER_US 1000
+static inline uint32_t profilerTicks() { return (uint32_t)hostNanos(); }
+static inline uint64_t profilerPixels() { return display.stats.pixels; }
+static inline uint64_t profilerBytes() { return display.stats.spiBytes; }
+#else
+#define PROFILER_TICKS_PER_US (F_CPU / 1000000)
+static inline uint32_t profilerTicks() { return ESP.getCycleCount(); }
+static inline uint64_t profilerPixels() { return dmaPushStats.bytes / 3; }
+static inline uint64_t profilerBytes() { return dmaPushStats.bytes; }
+#endif
+
+class RenderProfileScope {
+ public:
+  explicit RenderProfileScope(RenderProfileId id)
+    : id_(id), ticks_(profilerTicks()), pixels_(profilerPixels()), bytes_(profilerBytes()) {}
+  ~RenderProfileScope() {
+    RenderProfileEntry& e = renderProfile[id_];
+    e.calls++;
+    e.ticks += profilerTicks() - ticks_;
+    e.pixels += profilerPixels() - pixels_;
+    e.bytes += profilerBytes() - bytes_;
+  }
+
+ private:
+  RenderProfileId id_;
+  uint32_t ticks_;
+  uint64_t pixels_;
+  uint64_t bytes_;
+};
+
+#define RENDER_PROFILE(id) RenderProfileScope renderProfileScope_(id)
+
+void resetRenderProfile() {
+  memset(renderProfile, 0, sizeof(renderProfile));
+}
+
+#else
+#define RENDER_PROFILE(id) do {} while (0)
+#endif
+
+#endif
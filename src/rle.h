@@ -0,0 +1,99 @@
+#ifndef RLE_H
+#define RLE_H
+
+// Word-oriented PackBits for 16-bit pixels.
+//
+// The stream is a sequence of 16-bit tokens. A token with the top bit set is a
+// run: the low 15 bits give the length and the next word is the pixel to
+// repeat. Otherwise the token is a literal count followed by that many pixels.
+// Pixels are stored exactly as given (sprites hand them over byte-swapped),
+// and the decoder expands straight into RGB666 for the DMA line buffers, so a
+// compressed image never needs a full 16-bit copy in RAM.
+
+#include <stdint.h>
+#include <string.h>
+#include "color_convert.h"
+
+#define RLE_RUN_FLAG 0x8000
+#define RLE_MAX_COUNT 0x7FFF
+#define RLE_MIN_RUN 3  // shorter repeats are cheaper as literals
+
+// Compress `count` pixels into `dst`. Returns the number of words written, or
+// 0 if `capacity` is too small. With `dst` == nullptr only the size is computed.
+static inline uint32_t rleEncode16(const uint16_t* src, uint32_t count, uint16_t* dst, uint32_t capacity) {
+  uint32_t out = 0;
+  uint32_t i = 0;
+  while (i < count) {
+    uint32_t run = 1;
+    while (i + run < count && run < RLE_MAX_COUNT && src[i + run] == src[i]) run++;
+    if (run >= RLE_MIN_RUN) {
+      if (dst) {
+        if (out + 2 > capacity) return 0;
+        dst[out] = RLE_RUN_FLAG | run;
+        dst[out + 1] = src[i];
+      }
+      out += 2;
+      i += run;
+      continue;
+    }
+
+    // Literal: extend until the next worthwhile run starts
+    uint32_t start = i;
+    while (i < count && i - start < RLE_MAX_COUNT) {
+      if (i + 2 < count && src[i] == src[i + 1] && src[i] == src[i + 2]) break;
+      i++;
+    }
+    uint32_t len = i - start;
+    if (dst) {
+      if (out + 1 + len > capacity) return 0;
+      dst[out] = len;
+      memcpy(dst + out + 1, src + start, len * 2);
+    }
+    out += 1 + len;
+  }
+  return out;
+}
+
+// Streaming decoder state; decode calls continue where the previous one stopped
+struct RleReader {
+  const uint16_t* next;
+  uint16_t left;   // pixels remaining in the current token
+  bool run;
+  uint16_t value;  // pixel being repeated when `run`
+};
+
+static inline void rleBegin(RleReader& reader, const uint16_t* data) {
+  reader.next = data;
+  reader.left = 0;
+  reader.run = false;
+  reader.value = 0;
+}
+
+// Decode the next `count` pixels as packed RGB666
+static inline void rleDecodeRgb666(RleReader& reader, uint8_t* dst, int32_t count) {
+  while (count > 0) {
+    if (reader.left == 0) {
+      uint16_t token = *reader.next++;
+      reader.run = token & RLE_RUN_FLAG;
+      reader.left = token & RLE_MAX_COUNT;
+      if (reader.run) reader.value = *reader.next++;
+      continue;
+    }
+    int32_t n = (count < reader.left) ? count : reader.left;
+    if (reader.run) {
+      uint8_t c[3];
+      rgb565ToRgb666Pixel(reader.value, c);
+      for (int32_t i = 0; i < n; i++, dst += 3) {
+        dst[0] = c[0]; dst[1] = c[1]; dst[2] = c[2];
+      }
+    } else {
+      rgb565ToRgb666Run(reader.next, dst, n);
+      reader.next += n;
+      dst += n * 3;
+    }
+    reader.left -= n;
+    count -= n;
+  }
+}
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef RPM_INTERPOLATOR_H
+#define RPM_INTERPOLATOR_H
+
+// Display-side RPM prediction between ECU samples.
+//
+// The UART delivers 20-30 samples a second, which makes a 200 rpm/block bar
+// move in visible steps. Given the timestamps of the last three samples, the
+// interpolator extrapolates along their slope to the render time, so the bar
+// can be redrawn at the display's own frame rate:
+//  - the prediction never runs further ahead than one average sample period,
+//    so a stalled link holds the last value instead of drifting off;
+//  - a sample that lands well below the prediction (rev cut, clutch in, stall)
+//    restarts the history, so drops show immediately without overshoot;
+//  - the result is clamped to 0 and to `RPM_INTERP_MAX_STEP` around the last
+//    sample.
+
+#include <stdint.h>
+
+#ifndef RPM_INTERP_DROP
+#define RPM_INTERP_DROP 500  // rpm below the prediction that counts as a sudden drop
+#endif
+#ifndef RPM_INTERP_MAX_STEP
+#define RPM_INTERP_MAX_STEP 1000  // largest predicted move away from the last sample
+#endif
+#define RPM_INTERP_MAX_GAP 250  // ms; older history is not used for the slope
+
+struct RpmInterpolator {
+  int32_t value[3];  // oldest first
+  uint32_t time[3];
+  uint8_t count;     // valid samples, up to 3
+};
+
+static inline void rpmInterpolatorReset(RpmInterpolator& interp) { interp.count = 0; }
+
+// Predicted RPM at `now`
+static inline int32_t rpmInterpolatorAt(const RpmInterpolator& interp, uint32_t now) {
+  if (interp.count == 0) return 0;
+  uint8_t last = interp.count - 1;
+  int32_t latest = interp.value[last];
+  if (interp.count < 2) return latest;
+
+  // Slope over the whole history smooths out single-sample noise
+  int32_t span = (int32_t)(interp.time[last] - interp.time[0]);
+  if (span <= 0) return latest;
+  int32_t ahead = (int32_t)(now - interp.time[last]);
+  int32_t period = span / last;
+  if (ahead > period) ahead = period;
+
+  int32_t step = (interp.value[last] - interp.value[0]) * ahead / span;
+  if (step > RPM_INTERP_MAX_STEP) step = RPM_INTERP_MAX_STEP;
+  if (step < -RPM_INTERP_MAX_STEP) step = -RPM_INTERP_MAX_STEP;
+  int32_t predicted = latest + step;
+  return predicted < 0 ? 0 : predicted;
+}
+
+// Record a fresh ECU sample taken at `now`
+static inline void rpmInterpolatorAdd(RpmInterpolator& interp, int32_t rpm, uint32_t now) {
+  if (interp.count > 0) {
+    bool stale = now - interp.time[interp.count - 1] > RPM_INTERP_MAX_GAP;
+    bool drop = rpmInterpolatorAt(interp, now) - rpm > RPM_INTERP_DROP;
+    if (stale || drop) interp.count = 0;
+  }
+  if (interp.count == 3) {
+    interp.value[0] = interp.value[1];
+    interp.time[0] = interp.time[1];
+    interp.value[1] = interp.value[2];
+    interp.time[1] = interp.time[2];
+    interp.count = 2;
+  }
+  interp.value[interp.count] = rpm;
+  interp.time[interp.count] = now;
+  interp.count++;
+}
+
+#endif
@@ -0,0 +1,456 @@
+// Generated by tools/splash_pack.py from the splash images; rerun it rather than editing.
+#ifndef SPLASH_ASSETS_H
+#define SPLASH_ASSETS_H
+
+#include <Arduino.h>
+
+// ZetTech ECU     480x320, 19200 B unpacked
+// Mazduino ECU    480x320, 19200 B unpacked
+// Speeduino ECU   480x320, 19200 B unpacked
+#define SPLASH_PACK_COUNT 3
+
+const uint8_t splashPack[7044] PROGMEM = {
+  0x53, 0x50, 0x4b, 0x31, 0x03, 0x00, 0x00, 0x00, 0x5a, 0x65, 0x74, 0x54, 0x65, 0x63, 0x68, 0x20,
+  0x45, 0x43, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x40, 0x01, 0x5c, 0x00, 0x00, 0x00,
+  0x9a, 0x08, 0x00, 0x00, 0x4d, 0x61, 0x7a, 0x64, 0x75, 0x69, 0x6e, 0x6f, 0x20, 0x45, 0x43, 0x55,
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x40, 0x01, 0xf6, 0x08, 0x00, 0x00, 0x46, 0x0a, 0x00, 0x00,
+  0x53, 0x70, 0x65, 0x65, 0x64, 0x75, 0x69, 0x6e, 0x6f, 0x20, 0x45, 0x43, 0x55, 0x00, 0x00, 0x00,
+  0xe0, 0x01, 0x40, 0x01, 0x3c, 0x13, 0x00, 0x00, 0x48, 0x08, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9e,
+  0xea, 0x01, 0x81, 0xdd, 0x05, 0x81, 0xda, 0x0a, 0x81, 0xd4, 0x0e, 0x81, 0xd2, 0x0f, 0x81, 0xce,
+  0x14, 0x81, 0xcb, 0x16, 0x81, 0xc8, 0x19, 0x81, 0xc7, 0x19, 0x81, 0xc5, 0x1b, 0x81, 0xc5, 0x1b,
+  0x81, 0xc6, 0x1a, 0x81, 0xc7, 0x23, 0x0b, 0x10, 0x81, 0xa4, 0x3d, 0x81, 0xa4, 0x3d, 0x81, 0xa5,
+  0x3d, 0x81, 0xa4, 0x3d, 0x81, 0xa4, 0x4f, 0x0a, 0x04, 0x81, 0x6f, 0x04, 0x10, 0x5f, 0x81, 0x6c,
+  0x06, 0x0e, 0x60, 0x81, 0x6a, 0x7a, 0x81, 0x65, 0x7c, 0x80, 0x80, 0x1d, 0x80, 0xc6, 0x80, 0x82,
+  0x28, 0x04, 0x01, 0x04, 0x02, 0x02, 0x07, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x07, 0x02, 0x09,
+  0x03, 0x17, 0x04, 0x1d, 0x04, 0x12, 0x03, 0x3f, 0x02, 0x3b, 0x03, 0x80, 0xb0, 0x07, 0x07, 0x1a,
+  0x04, 0x01, 0x04, 0x01, 0x03, 0x04, 0x01, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x07, 0x01,
+  0x0a, 0x03, 0x17, 0x04, 0x1d, 0x04, 0x11, 0x01, 0x42, 0x01, 0x3a, 0x04, 0x80, 0xb1, 0x02, 0x0c,
+  0x1a, 0x04, 0x01, 0x03, 0x02, 0x03, 0x04, 0x01, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x07,
+  0x01, 0x0a, 0x03, 0x17, 0x04, 0x1d, 0x04, 0x80, 0x8f, 0x03, 0x80, 0xc0, 0x1a, 0x04, 0x01, 0x04,
+  0x01, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x07, 0x01, 0x0a, 0x03, 0x17,
+  0x04, 0x1d, 0x04, 0x80, 0x8e, 0x03, 0x80, 0xc1, 0x1a, 0x04, 0x01, 0x04, 0x01, 0x03, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x07, 0x01, 0x0a, 0x03, 0x17, 0x04, 0x1d, 0x04, 0x80,
+  0x8d, 0x03, 0x80, 0xc2, 0x1a, 0x04, 0x01, 0x04, 0x01, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x07, 0x01, 0x0a, 0x03, 0x17, 0x04, 0x1d, 0x04, 0x80, 0x8c, 0x03, 0x80, 0xc3,
+  0x1a, 0x04, 0x01, 0x04, 0x01, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x07,
+  0x01, 0x0a, 0x03, 0x17, 0x04, 0x1d, 0x04, 0x80, 0x8b, 0x03, 0x80, 0xb6, 0x04, 0x0a, 0x1a, 0x04,
+  0x01, 0x04, 0x01, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x07, 0x01, 0x0a,
+  0x03, 0x17, 0x04, 0x1d, 0x04, 0x80, 0x8a, 0x02, 0x80, 0xb8, 0x09, 0x05, 0x1a, 0x03, 0x02, 0x04,
+  0x01, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x07, 0x01, 0x0a, 0x03, 0x17,
+  0x04, 0x1d, 0x04, 0x80, 0x89, 0x02, 0x80, 0xb9, 0x0b, 0x03, 0x1a, 0x04, 0x01, 0x04, 0x01, 0x03,
+  0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x07, 0x01, 0x0a, 0x03, 0x17, 0x05, 0x1b,
+  0x05, 0x80, 0x88, 0x02, 0x80, 0xb4, 0x81, 0x64, 0x7b, 0x81, 0x67, 0x76, 0x81, 0x6c, 0x07, 0x0a,
+  0x55, 0x08, 0x05, 0x81, 0x6e, 0x04, 0x0e, 0x52, 0x0a, 0x03, 0x81, 0x84, 0x3c, 0x81, 0xa6, 0x38,
+  0x81, 0xab, 0x35, 0x81, 0xad, 0x33, 0x81, 0xad, 0x15, 0x81, 0xcc, 0x13, 0x81, 0xce, 0x08, 0x8f,
+  0x97, 0x1f, 0x44, 0x19, 0x02, 0x07, 0x51, 0x0b, 0x30, 0x1e, 0x0c, 0x07, 0x05, 0x0f, 0x0d, 0x0a,
+  0x0f, 0x09, 0x5b, 0x1f, 0x43, 0x23, 0x51, 0x0a, 0x31, 0x1d, 0x0a, 0x08, 0x05, 0x13, 0x0b, 0x0a,
+  0x0f, 0x07, 0x02, 0x02, 0x58, 0x20, 0x43, 0x23, 0x50, 0x0b, 0x30, 0x1e, 0x08, 0x06, 0x04, 0x18,
+  0x0a, 0x0b, 0x0e, 0x05, 0x04, 0x02, 0x59, 0x1f, 0x44, 0x22, 0x50, 0x0b, 0x31, 0x1d, 0x08, 0x04,
+  0x04, 0x1b, 0x09, 0x0b, 0x0f, 0x02, 0x04, 0x05, 0x58, 0x20, 0x43, 0x22, 0x51, 0x0b, 0x30, 0x1e,
+  0x0b, 0x20, 0x09, 0x0b, 0x11, 0x08, 0x59, 0x1f, 0x43, 0x23, 0x51, 0x0a, 0x31, 0x1e, 0x09, 0x22,
+  0x09, 0x0a, 0x10, 0x0a, 0x58, 0x1f, 0x44, 0x23, 0x50, 0x0b, 0x31, 0x1d, 0x08, 0x23, 0x09, 0x0b,
+  0x0f, 0x0a, 0x6b, 0x0c, 0x50, 0x0c, 0x5c, 0x0b, 0x30, 0x0b, 0x1a, 0x0b, 0x0d, 0x0c, 0x08, 0x0b,
+  0x0f, 0x0b, 0x6a, 0x0c, 0x51, 0x0b, 0x5c, 0x0b, 0x31, 0x0a, 0x1b, 0x0b, 0x0e, 0x0a, 0x09, 0x0b,
+  0x0e, 0x0b, 0x6b, 0x0b, 0x51, 0x0b, 0x5d, 0x0a, 0x31, 0x0b, 0x1a, 0x0b, 0x0e, 0x0b, 0x08, 0x0c,
+  0x0e, 0x0b, 0x6a, 0x0b, 0x31, 0x0b, 0x16, 0x0b, 0x5c, 0x0b, 0x30, 0x0b, 0x1b, 0x0b, 0x0e, 0x0b,
+  0x08, 0x0a, 0x10, 0x0a, 0x6a, 0x0b, 0x32, 0x0a, 0x17, 0x0a, 0x5d, 0x0b, 0x30, 0x0b, 0x1b, 0x0a,
+  0x0e, 0x0b, 0x09, 0x06, 0x13, 0x0b, 0x69, 0x0b, 0x32, 0x0b, 0x16, 0x0b, 0x5c, 0x0b, 0x31, 0x0a,
+  0x1b, 0x0b, 0x0e, 0x0a, 0x09, 0x04, 0x05, 0x02, 0x0f, 0x0a, 0x69, 0x0b, 0x33, 0x0a, 0x17, 0x0b,
+  0x5c, 0x0b, 0x30, 0x09, 0x1c, 0x0b, 0x0e, 0x0b, 0x08, 0x03, 0x05, 0x04, 0x0f, 0x0a, 0x68, 0x0c,
+  0x33, 0x0a, 0x16, 0x03, 0x01, 0x07, 0x5d, 0x0a, 0x30, 0x07, 0x1f, 0x0b, 0x0e, 0x0b, 0x0d, 0x06,
+  0x0f, 0x0b, 0x67, 0x0b, 0x34, 0x0a, 0x17, 0x01, 0x02, 0x07, 0x5d, 0x0b, 0x30, 0x02, 0x23, 0x0b,
+  0x0f, 0x0a, 0x0a, 0x0a, 0x0e, 0x0b, 0x67, 0x0c, 0x33, 0x0b, 0x16, 0x02, 0x01, 0x08, 0x5d, 0x0a,
+  0x3a, 0x01, 0x1b, 0x0b, 0x0e, 0x0b, 0x08, 0x0b, 0x0f, 0x0b, 0x66, 0x0b, 0x35, 0x0b, 0x18, 0x09,
+  0x5c, 0x0b, 0x38, 0x03, 0x1b, 0x0b, 0x0e, 0x0a, 0x09, 0x0b, 0x0f, 0x0b, 0x65, 0x0c, 0x35, 0x0a,
+  0x18, 0x09, 0x5d, 0x0a, 0x36, 0x05, 0x1b, 0x0b, 0x22, 0x0a, 0x0f, 0x0b, 0x65, 0x0c, 0x0f, 0x10,
+  0x04, 0x04, 0x09, 0x16, 0x11, 0x0a, 0x14, 0x0e, 0x01, 0x09, 0x0e, 0x0e, 0x01, 0x09, 0x0a, 0x0b,
+  0x09, 0x08, 0x20, 0x0a, 0x1b, 0x0a, 0x22, 0x0b, 0x0e, 0x0b, 0x65, 0x0c, 0x0f, 0x11, 0x03, 0x07,
+  0x06, 0x17, 0x10, 0x0a, 0x13, 0x0f, 0x01, 0x0b, 0x0a, 0x10, 0x01, 0x0b, 0x08, 0x0c, 0x03, 0x10,
+  0x1d, 0x0b, 0x1a, 0x0b, 0x22, 0x0a, 0x0f, 0x0b, 0x65, 0x0b, 0x0e, 0x12, 0x03, 0x08, 0x06, 0x17,
+  0x0f, 0x0b, 0x11, 0x1d, 0x09, 0x10, 0x02, 0x0b, 0x08, 0x1f, 0x1c, 0x0b, 0x1b, 0x0b, 0x21, 0x0a,
+  0x0f, 0x0c, 0x63, 0x0c, 0x0e, 0x12, 0x03, 0x09, 0x06, 0x16, 0x10, 0x0a, 0x11, 0x1e, 0x08, 0x11,
+  0x01, 0x0c, 0x08, 0x1f, 0x1c, 0x0a, 0x1c, 0x0a, 0x22, 0x0a, 0x0f, 0x0b, 0x64, 0x0b, 0x0f, 0x11,
+  0x03, 0x0a, 0x05, 0x17, 0x0f, 0x0b, 0x10, 0x11, 0x01, 0x0d, 0x07, 0x11, 0x02, 0x0c, 0x07, 0x20,
+  0x1c, 0x1a, 0x0b, 0x0b, 0x21, 0x0b, 0x0f, 0x0a, 0x63, 0x0c, 0x0f, 0x11, 0x03, 0x0a, 0x06, 0x16,
+  0x0f, 0x0b, 0x11, 0x11, 0x01, 0x0c, 0x08, 0x10, 0x02, 0x0c, 0x08, 0x1f, 0x1c, 0x1b, 0x0a, 0x0b,
+  0x21, 0x0b, 0x0f, 0x0b, 0x62, 0x0c, 0x10, 0x0a, 0x0a, 0x0a, 0x06, 0x15, 0x10, 0x0b, 0x11, 0x0a,
+  0x0a, 0x0a, 0x08, 0x0f, 0x03, 0x0c, 0x07, 0x20, 0x1c, 0x1b, 0x0a, 0x0b, 0x21, 0x0b, 0x0f, 0x0b,
+  0x62, 0x0b, 0x10, 0x0a, 0x0a, 0x0a, 0x0b, 0x0a, 0x17, 0x0a, 0x11, 0x0a, 0x0b, 0x0a, 0x07, 0x0b,
+  0x09, 0x0a, 0x08, 0x0a, 0x0a, 0x0b, 0x1c, 0x1b, 0x0b, 0x0a, 0x22, 0x0b, 0x0f, 0x0a, 0x62, 0x0b,
+  0x11, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x17, 0x0a, 0x11, 0x0a, 0x0a, 0x0a, 0x08, 0x0a, 0x0a, 0x0a,
+  0x08, 0x0a, 0x0a, 0x0b, 0x1c, 0x1a, 0x0b, 0x0b, 0x21, 0x0b, 0x0f, 0x0b, 0x61, 0x0b, 0x11, 0x0b,
+  0x09, 0x0a, 0x0b, 0x0a, 0x17, 0x0a, 0x12, 0x09, 0x0a, 0x0b, 0x07, 0x0b, 0x09, 0x0a, 0x08, 0x0b,
+  0x0a, 0x0a, 0x1c, 0x1b, 0x0a, 0x0b, 0x22, 0x0b, 0x0e, 0x0b, 0x60, 0x0c, 0x12, 0x0a, 0x0a, 0x0a,
+  0x0b, 0x0a, 0x16, 0x0b, 0x11, 0x0a, 0x0a, 0x0a, 0x08, 0x0a, 0x0a, 0x0a, 0x08, 0x0a, 0x0a, 0x0b,
+  0x1b, 0x1c, 0x0a, 0x0b, 0x22, 0x0a, 0x0f, 0x0b, 0x60, 0x0b, 0x13, 0x09, 0x0b, 0x0a, 0x0a, 0x0b,
+  0x16, 0x0b, 0x11, 0x0a, 0x09, 0x0b, 0x08, 0x0a, 0x09, 0x0b, 0x07, 0x0b, 0x0a, 0x0a, 0x1c, 0x0b,
+  0x1b, 0x0a, 0x22, 0x0b, 0x0f, 0x0b, 0x5f, 0x0b, 0x13, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x16, 0x0b,
+  0x11, 0x0a, 0x0a, 0x0a, 0x08, 0x0a, 0x0b, 0x09, 0x07, 0x0b, 0x0a, 0x0b, 0x1c, 0x0b, 0x1a, 0x0b,
+  0x21, 0x0b, 0x0f, 0x0b, 0x5f, 0x0b, 0x13, 0x0b, 0x09, 0x0b, 0x0a, 0x0a, 0x17, 0x0b, 0x11, 0x0a,
+  0x0a, 0x0a, 0x08, 0x0a, 0x1b, 0x0a, 0x0b, 0x0a, 0x1c, 0x0b, 0x1b, 0x0a, 0x22, 0x0b, 0x0e, 0x0b,
+  0x5f, 0x0b, 0x14, 0x0d, 0x03, 0x0e, 0x0b, 0x05, 0x01, 0x04, 0x16, 0x0b, 0x11, 0x0f, 0x01, 0x0e,
+  0x08, 0x0a, 0x1c, 0x0a, 0x0a, 0x0b, 0x1c, 0x0b, 0x1a, 0x0b, 0x22, 0x0a, 0x0f, 0x0b, 0x5e, 0x0b,
+  0x14, 0x0d, 0x03, 0x0f, 0x0a, 0x05, 0x02, 0x03, 0x17, 0x0b, 0x10, 0x0f, 0x01, 0x0f, 0x08, 0x0a,
+  0x1b, 0x0a, 0x0b, 0x0a, 0x1c, 0x0b, 0x1b, 0x0b, 0x21, 0x0b, 0x0f, 0x0a, 0x5e, 0x0b, 0x15, 0x0c,
+  0x03, 0x10, 0x0a, 0x05, 0x01, 0x04, 0x16, 0x0b, 0x11, 0x0f, 0x01, 0x0e, 0x08, 0x0b, 0x1b, 0x09,
+  0x0b, 0x0b, 0x1c, 0x0b, 0x1a, 0x0b, 0x21, 0x0c, 0x0e, 0x0b, 0x5d, 0x0b, 0x16, 0x0c, 0x02, 0x0f,
+  0x0b, 0x05, 0x02, 0x04, 0x16, 0x0b, 0x10, 0x0f, 0x01, 0x0e, 0x08, 0x0b, 0x1b, 0x0a, 0x0b, 0x0b,
+  0x1c, 0x0a, 0x1b, 0x0a, 0x0f, 0x0a, 0x09, 0x0b, 0x0e, 0x0a, 0x5e, 0x0b, 0x16, 0x0c, 0x02, 0x0e,
+  0x0c, 0x05, 0x02, 0x04, 0x16, 0x0b, 0x11, 0x0e, 0x02, 0x0c, 0x0a, 0x0b, 0x1b, 0x08, 0x0c, 0x0b,
+  0x1c, 0x0b, 0x1a, 0x0b, 0x0e, 0x0b, 0x08, 0x0b, 0x0f, 0x05, 0x62, 0x0b, 0x16, 0x0b, 0x1e, 0x05,
+  0x02, 0x03, 0x17, 0x0b, 0x11, 0x0a, 0x1c, 0x0a, 0x1c, 0x07, 0x02, 0x01, 0x0a, 0x0a, 0x1c, 0x0b,
+  0x1b, 0x0b, 0x0e, 0x0b, 0x08, 0x0b, 0x0f, 0x03, 0x63, 0x0b, 0x17, 0x0a, 0x1f, 0x04, 0x02, 0x04,
+  0x17, 0x0a, 0x11, 0x0a, 0x1c, 0x0b, 0x1b, 0x08, 0x01, 0x02, 0x09, 0x0b, 0x1c, 0x0b, 0x1b, 0x0a,
+  0x0e, 0x0b, 0x09, 0x0b, 0x15, 0x04, 0x5b, 0x0b, 0x18, 0x0a, 0x1e, 0x04, 0x02, 0x05, 0x16, 0x0b,
+  0x11, 0x0a, 0x1c, 0x0a, 0x1b, 0x0b, 0x0a, 0x0b, 0x1c, 0x0a, 0x1b, 0x0b, 0x0e, 0x0a, 0x09, 0x0b,
+  0x14, 0x06, 0x5a, 0x0b, 0x18, 0x0a, 0x1f, 0x04, 0x02, 0x04, 0x16, 0x0b, 0x12, 0x09, 0x1c, 0x0b,
+  0x09, 0x0a, 0x08, 0x08, 0x01, 0x02, 0x0a, 0x0a, 0x1c, 0x0b, 0x1a, 0x0b, 0x0e, 0x0b, 0x08, 0x0c,
+  0x0f, 0x0a, 0x5a, 0x0b, 0x19, 0x09, 0x0b, 0x0a, 0x0a, 0x04, 0x03, 0x04, 0x16, 0x0b, 0x11, 0x0a,
+  0x0a, 0x0a, 0x08, 0x0a, 0x09, 0x0b, 0x08, 0x07, 0x01, 0x02, 0x0a, 0x0b, 0x1b, 0x0c, 0x1a, 0x0b,
+  0x0e, 0x0b, 0x08, 0x0b, 0x0f, 0x0b, 0x59, 0x0c, 0x18, 0x0a, 0x0a, 0x0b, 0x0a, 0x04, 0x02, 0x04,
+  0x17, 0x0b, 0x10, 0x0b, 0x0a, 0x0a, 0x07, 0x0b, 0x09, 0x0a, 0x08, 0x07, 0x01, 0x02, 0x0a, 0x0b,
+  0x1c, 0x07, 0x1f, 0x0a, 0x0e, 0x0b, 0x09, 0x0b, 0x0e, 0x0b, 0x59, 0x0c, 0x19, 0x09, 0x0b, 0x0a,
+  0x0a, 0x04, 0x02, 0x05, 0x17, 0x0a, 0x11, 0x0a, 0x0a, 0x0a, 0x08, 0x0a, 0x0a, 0x0a, 0x07, 0x07,
+  0x02, 0x02, 0x0a, 0x0b, 0x1c, 0x06, 0x1f, 0x0b, 0x0e, 0x0b, 0x08, 0x0a, 0x10, 0x0b, 0x58, 0x0c,
+  0x19, 0x09, 0x0c, 0x0a, 0x0a, 0x04, 0x02, 0x04, 0x17, 0x0a, 0x12, 0x09, 0x0a, 0x0b, 0x08, 0x0a,
+  0x09, 0x0b, 0x07, 0x06, 0x02, 0x03, 0x0a, 0x0a, 0x1c, 0x03, 0x23, 0x0b, 0x0d, 0x0b, 0x09, 0x05,
+  0x15, 0x0a, 0x58, 0x0d, 0x04, 0x0f, 0x06, 0x0a, 0x0a, 0x0a, 0x0b, 0x03, 0x02, 0x06, 0x15, 0x0b,
+  0x11, 0x0a, 0x0a, 0x0a, 0x08, 0x0a, 0x0a, 0x0a, 0x08, 0x05, 0x02, 0x03, 0x0a, 0x0b, 0x24, 0x16,
+  0x07, 0x0b, 0x0e, 0x0b, 0x09, 0x01, 0x08, 0x02, 0x0e, 0x0b, 0x57, 0x0d, 0x04, 0x10, 0x06, 0x0a,
+  0x0a, 0x0a, 0x0a, 0x04, 0x02, 0x0b, 0x10, 0x0b, 0x10, 0x0b, 0x0a, 0x0a, 0x08, 0x0b, 0x02, 0x11,
+  0x07, 0x06, 0x01, 0x04, 0x0a, 0x0a, 0x23, 0x17, 0x08, 0x23, 0x0f, 0x1e, 0x57, 0x0d, 0x03, 0x11,
+  0x06, 0x1e, 0x0a, 0x04, 0x02, 0x0c, 0x10, 0x0a, 0x11, 0x1e, 0x08, 0x0c, 0x01, 0x11, 0x07, 0x05,
+  0x03, 0x03, 0x0a, 0x0b, 0x20, 0x1a, 0x07, 0x24, 0x0b, 0x22, 0x57, 0x0c, 0x02, 0x13, 0x06, 0x1e,
+  0x0a, 0x03, 0x02, 0x0d, 0x0f, 0x0b, 0x11, 0x1e, 0x08, 0x0b, 0x02, 0x11, 0x07, 0x05, 0x02, 0x04,
+  0x0a, 0x0a, 0x1c, 0x1e, 0x08, 0x23, 0x09, 0x25, 0x56, 0x0d, 0x02, 0x12, 0x06, 0x1e, 0x0b, 0x02,
+  0x03, 0x0c, 0x10, 0x0a, 0x12, 0x1d, 0x08, 0x0c, 0x01, 0x11, 0x08, 0x04, 0x02, 0x04, 0x0a, 0x0b,
+  0x1c, 0x1e, 0x08, 0x20, 0x0c, 0x24, 0x56, 0x0d, 0x01, 0x14, 0x06, 0x1d, 0x0c, 0x02, 0x02, 0x0d,
+  0x0f, 0x0b, 0x12, 0x1c, 0x09, 0x0b, 0x01, 0x11, 0x08, 0x05, 0x01, 0x05, 0x0a, 0x0b, 0x1c, 0x1d,
+  0x09, 0x1b, 0x11, 0x23, 0x57, 0x21, 0x08, 0x1b, 0x0d, 0x01, 0x02, 0x0d, 0x10, 0x0a, 0x13, 0x1b,
+  0x0b, 0x0a, 0x01, 0x10, 0x09, 0x04, 0x02, 0x05, 0x09, 0x0b, 0x1c, 0x1e, 0x09, 0x19, 0x13, 0x21,
+  0x98, 0xeb, 0x09, 0x81, 0xd7, 0x09, 0x81, 0xd6, 0x0a, 0x81, 0xd6, 0x0a, 0x81, 0xb9, 0x05, 0x02,
+  0x10, 0x06, 0x0d, 0x81, 0xb6, 0x2c, 0x81, 0xb3, 0x2e, 0x81, 0x97, 0x49, 0x81, 0x94, 0x59, 0x1a,
+  0x02, 0x81, 0x6a, 0x65, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x01, 0x06, 0x81, 0x62, 0x80, 0x81,
+  0x81, 0x5f, 0x80, 0x81, 0x80, 0xb4, 0x1b, 0x06, 0x16, 0x03, 0x0a, 0x01, 0x08, 0x01, 0x03, 0x02,
+  0x03, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x04, 0x01, 0x3c, 0x80, 0x81,
+  0x11, 0x4b, 0x02, 0x50, 0x06, 0x1c, 0x05, 0x16, 0x03, 0x0a, 0x01, 0x08, 0x01, 0x03, 0x02, 0x03,
+  0x02, 0x04, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x02, 0x3c, 0x80, 0xdb, 0x02, 0x52, 0x06,
+  0x1c, 0x05, 0x16, 0x03, 0x0a, 0x01, 0x08, 0x01, 0x03, 0x02, 0x03, 0x02, 0x01, 0x01, 0x02, 0x02,
+  0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x3c, 0x80, 0xda, 0x02, 0x53, 0x06, 0x1c, 0x05, 0x16,
+  0x03, 0x0a, 0x01, 0x08, 0x01, 0x03, 0x02, 0x03, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x03, 0x3c, 0x80, 0xd9, 0x02, 0x54, 0x06, 0x1c, 0x05, 0x16, 0x03, 0x0a, 0x01,
+  0x08, 0x01, 0x03, 0x02, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x39,
+  0x80, 0xdb, 0x02, 0x55, 0x06, 0x1c, 0x05, 0x16, 0x03, 0x0a, 0x01, 0x08, 0x01, 0x03, 0x02, 0x03,
+  0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x34, 0x03, 0x02, 0x80, 0xda, 0x02,
+  0x56, 0x06, 0x1c, 0x05, 0x16, 0x03, 0x0a, 0x01, 0x08, 0x01, 0x03, 0x02, 0x03, 0x02, 0x04, 0x02,
+  0x01, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x34, 0x03, 0x03, 0x80, 0xd8, 0x02, 0x57, 0x06, 0x1c,
+  0x05, 0x16, 0x03, 0x0a, 0x01, 0x08, 0x01, 0x03, 0x02, 0x03, 0x02, 0x04, 0x02, 0x01, 0x03, 0x03,
+  0x02, 0x03, 0x02, 0x03, 0x34, 0x03, 0x05, 0x81, 0x2f, 0x06, 0x1c, 0x05, 0x16, 0x03, 0x0a, 0x01,
+  0x08, 0x01, 0x03, 0x02, 0x03, 0x02, 0x04, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x34, 0x03, 0x05,
+  0x81, 0x2f, 0x06, 0x1c, 0x05, 0x16, 0x03, 0x09, 0x02, 0x08, 0x01, 0x03, 0x02, 0x03, 0x02, 0x04,
+  0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x34, 0x03, 0x05, 0x80, 0x81, 0x0d, 0x1f, 0x02, 0x80, 0x80,
+  0x06, 0x1c, 0x80, 0x87, 0x03, 0x05, 0x80, 0x81, 0x81, 0x57, 0x7a, 0x01, 0x0c, 0x81, 0x5c, 0x61,
+  0x0c, 0x02, 0x04, 0x03, 0x03, 0x02, 0x03, 0x03, 0x81, 0x64, 0x4e, 0x81, 0x97, 0x48, 0x81, 0x98,
+  0x01, 0x02, 0x01, 0x04, 0x01, 0x06, 0x01, 0x0b, 0x2d, 0x81, 0xb3, 0x2c, 0x81, 0xb4, 0x05, 0x02,
+  0x23, 0x81, 0xb8, 0x01, 0x04, 0x0f, 0x08, 0x09, 0x81, 0xd7, 0x09, 0x81, 0xd7, 0x09, 0x81, 0xd7,
+  0x08, 0xff, 0xff, 0x00, 0x9f, 0x13, 0xff, 0xff, 0x00, 0x86, 0x0d, 0x05, 0x81, 0xda, 0x08, 0x81,
+  0xc3, 0x04, 0x10, 0x0a, 0x0f, 0x04, 0x81, 0xab, 0x08, 0x0f, 0x0b, 0x0f, 0x07, 0x81, 0xa6, 0x0a,
+  0x0f, 0x0b, 0x0f, 0x0a, 0x81, 0xa0, 0x0d, 0x0f, 0x0b, 0x0f, 0x0d, 0x81, 0x9b, 0x0f, 0x0f, 0x0b,
+  0x0f, 0x0f, 0x81, 0x96, 0x12, 0x0f, 0x0b, 0x0f, 0x12, 0x81, 0x91, 0x14, 0x0f, 0x0b, 0x0f, 0x14,
+  0x81, 0x8d, 0x16, 0x0f, 0x0b, 0x0f, 0x15, 0x81, 0x8a, 0x18, 0x0f, 0x0b, 0x0f, 0x17, 0x81, 0x87,
+  0x19, 0x0e, 0x0d, 0x0e, 0x19, 0x81, 0x83, 0x1b, 0x0d, 0x0f, 0x0d, 0x1b, 0x81, 0x7f, 0x1d, 0x0c,
+  0x11, 0x0c, 0x1c, 0x81, 0x7d, 0x1e, 0x0b, 0x13, 0x0b, 0x1e, 0x81, 0x79, 0x20, 0x0b, 0x13, 0x0b,
+  0x1f, 0x81, 0x77, 0x1f, 0x0d, 0x13, 0x0d, 0x1e, 0x81, 0x75, 0x1d, 0x10, 0x13, 0x10, 0x1d, 0x81,
+  0x72, 0x1b, 0x13, 0x13, 0x13, 0x1b, 0x81, 0x6f, 0x1b, 0x15, 0x13, 0x15, 0x1a, 0x81, 0x6d, 0x19,
+  0x0b, 0x02, 0x0e, 0x0e, 0x0d, 0x02, 0x0b, 0x18, 0x81, 0x6b, 0x18, 0x0a, 0x05, 0x1e, 0x01, 0x0a,
+  0x05, 0x0a, 0x18, 0x81, 0x68, 0x17, 0x09, 0x08, 0x09, 0x17, 0x09, 0x07, 0x0a, 0x17, 0x81, 0x66,
+  0x17, 0x08, 0x0a, 0x09, 0x17, 0x09, 0x0a, 0x08, 0x17, 0x81, 0x64, 0x16, 0x08, 0x0c, 0x0a, 0x15,
+  0x0a, 0x0c, 0x08, 0x16, 0x81, 0x62, 0x15, 0x08, 0x0e, 0x0a, 0x15, 0x0a, 0x0e, 0x08, 0x15, 0x81,
+  0x60, 0x15, 0x07, 0x10, 0x0a, 0x15, 0x0a, 0x10, 0x07, 0x15, 0x81, 0x5e, 0x14, 0x07, 0x12, 0x0b,
+  0x13, 0x0b, 0x11, 0x07, 0x15, 0x81, 0x5c, 0x14, 0x07, 0x13, 0x29, 0x13, 0x07, 0x14, 0x81, 0x5a,
+  0x14, 0x09, 0x12, 0x08, 0x05, 0x0f, 0x05, 0x08, 0x12, 0x09, 0x14, 0x81, 0x58, 0x14, 0x06, 0x02,
+  0x02, 0x12, 0x08, 0x19, 0x08, 0x11, 0x03, 0x02, 0x06, 0x13, 0x81, 0x57, 0x14, 0x06, 0x04, 0x02,
+  0x11, 0x09, 0x17, 0x09, 0x10, 0x03, 0x04, 0x06, 0x13, 0x81, 0x56, 0x12, 0x06, 0x07, 0x02, 0x10,
+  0x09, 0x17, 0x09, 0x10, 0x02, 0x06, 0x06, 0x13, 0x81, 0x54, 0x12, 0x06, 0x08, 0x03, 0x0f, 0x09,
+  0x17, 0x09, 0x0f, 0x02, 0x09, 0x06, 0x12, 0x81, 0x52, 0x12, 0x06, 0x0a, 0x02, 0x0f, 0x09, 0x17,
+  0x09, 0x0e, 0x03, 0x0a, 0x05, 0x13, 0x81, 0x50, 0x12, 0x06, 0x0c, 0x02, 0x0e, 0x0e, 0x0d, 0x0e,
+  0x0e, 0x02, 0x0c, 0x06, 0x11, 0x81, 0x50, 0x11, 0x06, 0x0e, 0x02, 0x0d, 0x1f, 0x01, 0x09, 0x0d,
+  0x02, 0x0e, 0x05, 0x12, 0x81, 0x4e, 0x11, 0x06, 0x0f, 0x03, 0x0c, 0x08, 0x18, 0x09, 0x0c, 0x02,
+  0x10, 0x05, 0x12, 0x81, 0x4c, 0x12, 0x05, 0x11, 0x02, 0x0c, 0x09, 0x17, 0x09, 0x0b, 0x03, 0x11,
+  0x05, 0x11, 0x81, 0x4b, 0x12, 0x05, 0x13, 0x02, 0x0b, 0x09, 0x17, 0x09, 0x0b, 0x02, 0x13, 0x05,
+  0x11, 0x81, 0x4a, 0x11, 0x05, 0x15, 0x02, 0x0a, 0x09, 0x17, 0x09, 0x0a, 0x02, 0x15, 0x05, 0x11,
+  0x81, 0x48, 0x11, 0x05, 0x16, 0x03, 0x09, 0x09, 0x17, 0x09, 0x09, 0x02, 0x17, 0x05, 0x10, 0x81,
+  0x47, 0x11, 0x05, 0x18, 0x02, 0x09, 0x0a, 0x14, 0x0b, 0x09, 0x02, 0x18, 0x05, 0x10, 0x81, 0x46,
+  0x10, 0x07, 0x18, 0x02, 0x08, 0x29, 0x08, 0x02, 0x18, 0x06, 0x11, 0x81, 0x44, 0x11, 0x08, 0x18,
+  0x02, 0x07, 0x08, 0x05, 0x0f, 0x05, 0x08, 0x07, 0x02, 0x18, 0x08, 0x10, 0x81, 0x44, 0x10, 0x05,
+  0x02, 0x03, 0x17, 0x02, 0x07, 0x08, 0x18, 0x09, 0x07, 0x01, 0x18, 0x03, 0x02, 0x05, 0x10, 0x81,
+  0x42, 0x10, 0x05, 0x04, 0x03, 0x17, 0x01, 0x07, 0x09, 0x17, 0x09, 0x06, 0x02, 0x17, 0x03, 0x04,
+  0x05, 0x0f, 0x81, 0x42, 0x10, 0x04, 0x06, 0x03, 0x1e, 0x09, 0x17, 0x09, 0x1e, 0x02, 0x06, 0x05,
+  0x10, 0x81, 0x40, 0x10, 0x05, 0x08, 0x02, 0x1d, 0x09, 0x17, 0x08, 0x1e, 0x02, 0x08, 0x05, 0x0f,
+  0x81, 0x40, 0x0f, 0x05, 0x0a, 0x02, 0x1c, 0x09, 0x17, 0x08, 0x1d, 0x02, 0x0a, 0x04, 0x10, 0x81,
+  0x3e, 0x10, 0x04, 0x0c, 0x03, 0x1a, 0x10, 0x0a, 0x0f, 0x1a, 0x03, 0x0b, 0x05, 0x10, 0x81, 0x3d,
+  0x0f, 0x05, 0x0d, 0x03, 0x19, 0x09, 0x01, 0x15, 0x01, 0x09, 0x19, 0x03, 0x0d, 0x05, 0x0f, 0x81,
+  0x3c, 0x10, 0x04, 0x0f, 0x03, 0x18, 0x08, 0x19, 0x08, 0x18, 0x03, 0x0f, 0x04, 0x10, 0x81, 0x3b,
+  0x0f, 0x05, 0x10, 0x03, 0x17, 0x08, 0x18, 0x09, 0x17, 0x03, 0x10, 0x05, 0x0f, 0x81, 0x3a, 0x10,
+  0x04, 0x12, 0x03, 0x16, 0x09, 0x17, 0x09, 0x16, 0x03, 0x12, 0x04, 0x0f, 0x81, 0x3a, 0x0f, 0x05,
+  0x14, 0x02, 0x15, 0x09, 0x17, 0x09, 0x15, 0x02, 0x14, 0x05, 0x0f, 0x81, 0x39, 0x0f, 0x04, 0x16,
+  0x02, 0x14, 0x09, 0x17, 0x09, 0x14, 0x02, 0x16, 0x04, 0x0f, 0x81, 0x38, 0x0f, 0x05, 0x17, 0x02,
+  0x13, 0x0a, 0x15, 0x0a, 0x13, 0x02, 0x17, 0x05, 0x0f, 0x81, 0x37, 0x0f, 0x04, 0x19, 0x02, 0x12,
+  0x29, 0x12, 0x02, 0x19, 0x04, 0x0f, 0x81, 0x36, 0x41, 0x07, 0x05, 0x11, 0x05, 0x07, 0x12, 0x01,
+  0x2d, 0x81, 0x36, 0x41, 0x06, 0x1d, 0x06, 0x41, 0x81, 0x2d, 0x49, 0x06, 0x1d, 0x06, 0x49, 0x81,
+  0x1d, 0x51, 0x06, 0x1d, 0x06, 0x51, 0x81, 0x12, 0x17, 0x09, 0x08, 0x09, 0x0a, 0x01, 0x05, 0x19,
+  0x02, 0x08, 0x04, 0x03, 0x0b, 0x09, 0x09, 0x09, 0x08, 0x08, 0x09, 0x09, 0x07, 0x02, 0x14, 0x8c,
+  0x02, 0x03, 0x24, 0x09, 0x19, 0x0c, 0x18, 0x01, 0x02, 0x20, 0x0c, 0x07, 0x01, 0x17, 0x13, 0x08,
+  0x15, 0x05, 0x10, 0x02, 0x13, 0x08, 0x17, 0x07, 0x15, 0x19, 0x76, 0x0b, 0x1b, 0x0c, 0x17, 0x0e,
+  0x16, 0x25, 0x0a, 0x21, 0x11, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x0b, 0x0b, 0x14, 0x0b, 0x10, 0x1d,
+  0x74, 0x0c, 0x19, 0x0d, 0x17, 0x0e, 0x16, 0x25, 0x0a, 0x22, 0x10, 0x0a, 0x14, 0x0a, 0x0a, 0x0a,
+  0x0b, 0x0c, 0x13, 0x0b, 0x0f, 0x1f, 0x73, 0x0d, 0x18, 0x0d, 0x16, 0x10, 0x15, 0x25, 0x0a, 0x23,
+  0x0f, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x0b, 0x0d, 0x12, 0x0b, 0x0e, 0x21, 0x72, 0x0e, 0x16, 0x0e,
+  0x16, 0x10, 0x15, 0x25, 0x0a, 0x25, 0x0d, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x0b, 0x0e, 0x11, 0x0b,
+  0x0d, 0x23, 0x71, 0x0e, 0x15, 0x0f, 0x15, 0x12, 0x14, 0x25, 0x0a, 0x26, 0x0c, 0x0a, 0x14, 0x0a,
+  0x0a, 0x0a, 0x0b, 0x0e, 0x11, 0x0b, 0x0c, 0x25, 0x70, 0x0f, 0x14, 0x0f, 0x15, 0x12, 0x14, 0x25,
+  0x0a, 0x27, 0x0b, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x0b, 0x0f, 0x10, 0x0b, 0x0a, 0x28, 0x6f, 0x10,
+  0x12, 0x10, 0x15, 0x12, 0x14, 0x25, 0x0a, 0x28, 0x0a, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x0b, 0x10,
+  0x0f, 0x0b, 0x0a, 0x29, 0x6e, 0x10, 0x11, 0x11, 0x14, 0x14, 0x13, 0x25, 0x0a, 0x28, 0x0a, 0x0a,
+  0x14, 0x0a, 0x0a, 0x0a, 0x0b, 0x11, 0x0e, 0x0b, 0x0a, 0x29, 0x6e, 0x11, 0x10, 0x11, 0x14, 0x14,
+  0x13, 0x24, 0x0b, 0x28, 0x0a, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x0b, 0x12, 0x0d, 0x0b, 0x0a, 0x29,
+  0x6e, 0x12, 0x0e, 0x12, 0x13, 0x16, 0x28, 0x0d, 0x0c, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x14, 0x0a,
+  0x0a, 0x0a, 0x0b, 0x13, 0x0c, 0x0b, 0x0a, 0x0a, 0x14, 0x0b, 0x6e, 0x12, 0x0d, 0x13, 0x13, 0x16,
+  0x27, 0x0e, 0x0c, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x0b, 0x14, 0x0b, 0x0b,
+  0x0a, 0x0a, 0x15, 0x0a, 0x6e, 0x13, 0x0c, 0x13, 0x12, 0x0b, 0x02, 0x0b, 0x25, 0x0e, 0x0d, 0x0a,
+  0x14, 0x0a, 0x0a, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x0b, 0x15, 0x0a, 0x0b, 0x0a, 0x0a, 0x15, 0x0a,
+  0x6e, 0x14, 0x0a, 0x14, 0x12, 0x0b, 0x03, 0x0a, 0x24, 0x0e, 0x0e, 0x0a, 0x14, 0x0a, 0x0a, 0x0a,
+  0x14, 0x0a, 0x0a, 0x0a, 0x0b, 0x15, 0x0a, 0x0b, 0x0a, 0x0a, 0x15, 0x0a, 0x6e, 0x14, 0x09, 0x15,
+  0x11, 0x0b, 0x04, 0x0a, 0x23, 0x0e, 0x0f, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x13, 0x0b, 0x0a, 0x0a,
+  0x0b, 0x16, 0x09, 0x0b, 0x0a, 0x0a, 0x15, 0x0a, 0x6e, 0x15, 0x08, 0x15, 0x11, 0x0b, 0x04, 0x0b,
+  0x21, 0x0e, 0x10, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x13, 0x0b, 0x0a, 0x0a, 0x0b, 0x17, 0x08, 0x0b,
+  0x0a, 0x0a, 0x15, 0x0a, 0x6e, 0x16, 0x06, 0x16, 0x10, 0x0b, 0x06, 0x0a, 0x20, 0x0e, 0x11, 0x0a,
+  0x14, 0x0a, 0x0a, 0x0a, 0x13, 0x0b, 0x0a, 0x0a, 0x0b, 0x18, 0x07, 0x0b, 0x0a, 0x0a, 0x15, 0x0a,
+  0x6e, 0x16, 0x05, 0x17, 0x10, 0x0b, 0x06, 0x0b, 0x1e, 0x0e, 0x12, 0x0a, 0x14, 0x0a, 0x0a, 0x0a,
+  0x13, 0x0b, 0x0a, 0x0a, 0x0b, 0x0a, 0x02, 0x0d, 0x06, 0x0b, 0x0a, 0x0a, 0x15, 0x0a, 0x6e, 0x0a,
+  0x01, 0x0c, 0x04, 0x0b, 0x01, 0x0b, 0x10, 0x0b, 0x07, 0x0a, 0x1d, 0x0e, 0x13, 0x0a, 0x14, 0x0a,
+  0x0a, 0x0a, 0x13, 0x0b, 0x0a, 0x0a, 0x0b, 0x0a, 0x03, 0x0d, 0x05, 0x0b, 0x0a, 0x0a, 0x15, 0x0a,
+  0x6e, 0x0a, 0x02, 0x0c, 0x02, 0x0c, 0x01, 0x0b, 0x0f, 0x0b, 0x08, 0x0b, 0x1b, 0x0e, 0x14, 0x0a,
+  0x14, 0x0a, 0x0a, 0x0a, 0x13, 0x0b, 0x0a, 0x0a, 0x0b, 0x0a, 0x03, 0x0e, 0x04, 0x0b, 0x0a, 0x0a,
+  0x15, 0x0a, 0x6e, 0x0a, 0x03, 0x0b, 0x01, 0x0c, 0x02, 0x0b, 0x0f, 0x0b, 0x09, 0x0a, 0x1a, 0x0e,
+  0x15, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x13, 0x0b, 0x0a, 0x0a, 0x0b, 0x0a, 0x04, 0x0e, 0x03, 0x0b,
+  0x0a, 0x0a, 0x15, 0x0a, 0x6e, 0x0a, 0x03, 0x17, 0x03, 0x0b, 0x0e, 0x0b, 0x0a, 0x0b, 0x18, 0x0e,
+  0x16, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x13, 0x0b, 0x0a, 0x0a, 0x0b, 0x0a, 0x05, 0x0e, 0x02, 0x0b,
+  0x0a, 0x0a, 0x15, 0x0a, 0x6e, 0x0a, 0x04, 0x16, 0x03, 0x0b, 0x0e, 0x0b, 0x0a, 0x0b, 0x17, 0x0e,
+  0x17, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x13, 0x0b, 0x0a, 0x0a, 0x0b, 0x0a, 0x06, 0x0e, 0x01, 0x0b,
+  0x0a, 0x0a, 0x15, 0x0a, 0x6e, 0x0a, 0x05, 0x14, 0x04, 0x0b, 0x0d, 0x0c, 0x0a, 0x0c, 0x15, 0x0e,
+  0x18, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x13, 0x0b, 0x0a, 0x0a, 0x0b, 0x0a, 0x07, 0x19, 0x0a, 0x0a,
+  0x15, 0x0a, 0x6e, 0x0a, 0x06, 0x12, 0x05, 0x0b, 0x0d, 0x22, 0x14, 0x0e, 0x19, 0x0a, 0x14, 0x0a,
+  0x0a, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x0b, 0x0a, 0x08, 0x18, 0x0a, 0x0a, 0x15, 0x0a, 0x6e, 0x0a,
+  0x06, 0x12, 0x05, 0x0b, 0x0d, 0x22, 0x13, 0x0e, 0x1a, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x14, 0x0a,
+  0x0a, 0x0a, 0x0b, 0x0a, 0x09, 0x17, 0x0a, 0x0a, 0x15, 0x0a, 0x6e, 0x0a, 0x07, 0x10, 0x06, 0x0b,
+  0x0c, 0x24, 0x11, 0x0e, 0x1b, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x0b, 0x0a,
+  0x09, 0x17, 0x0a, 0x0a, 0x15, 0x0a, 0x6e, 0x0a, 0x08, 0x0e, 0x07, 0x0b, 0x0c, 0x24, 0x11, 0x0d,
+  0x1c, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x13, 0x0b, 0x0a, 0x0a, 0x0b, 0x0a, 0x0a, 0x16, 0x0a, 0x0a,
+  0x15, 0x0a, 0x6e, 0x0a, 0x08, 0x0e, 0x07, 0x0b, 0x0b, 0x26, 0x0f, 0x0d, 0x1d, 0x0a, 0x14, 0x0a,
+  0x0a, 0x0a, 0x13, 0x0b, 0x0a, 0x0a, 0x0b, 0x0a, 0x0b, 0x15, 0x0a, 0x0a, 0x15, 0x0a, 0x6e, 0x0a,
+  0x09, 0x0c, 0x08, 0x0b, 0x0b, 0x26, 0x0e, 0x0d, 0x1e, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x13, 0x0b,
+  0x0a, 0x0a, 0x0b, 0x0a, 0x0c, 0x14, 0x0a, 0x0a, 0x15, 0x0a, 0x6e, 0x0a, 0x0a, 0x0a, 0x09, 0x0b,
+  0x0b, 0x27, 0x0c, 0x0e, 0x1e, 0x0a, 0x14, 0x0a, 0x0a, 0x0a, 0x13, 0x0b, 0x0a, 0x0a, 0x0b, 0x0a,
+  0x0d, 0x13, 0x0a, 0x0a, 0x14, 0x0b, 0x6e, 0x0a, 0x0a, 0x0a, 0x09, 0x0b, 0x0a, 0x28, 0x0b, 0x23,
+  0x0a, 0x28, 0x0a, 0x28, 0x0a, 0x0a, 0x0b, 0x0a, 0x0e, 0x12, 0x0a, 0x29, 0x6e, 0x0a, 0x0b, 0x08,
+  0x0a, 0x0b, 0x0a, 0x29, 0x09, 0x24, 0x0a, 0x28, 0x0a, 0x28, 0x0a, 0x0a, 0x0b, 0x0a, 0x0f, 0x11,
+  0x0a, 0x29, 0x6e, 0x0a, 0x1d, 0x0b, 0x09, 0x0b, 0x13, 0x0c, 0x08, 0x25, 0x0a, 0x28, 0x0a, 0x27,
+  0x0b, 0x0a, 0x0b, 0x0a, 0x10, 0x10, 0x0a, 0x29, 0x6e, 0x0a, 0x1d, 0x0b, 0x09, 0x0b, 0x14, 0x0b,
+  0x08, 0x25, 0x0a, 0x27, 0x0c, 0x26, 0x0b, 0x0a, 0x0b, 0x0a, 0x11, 0x0f, 0x0b, 0x27, 0x6f, 0x0a,
+  0x1d, 0x0b, 0x08, 0x0b, 0x16, 0x0b, 0x07, 0x25, 0x0a, 0x26, 0x0e, 0x24, 0x0c, 0x0a, 0x0b, 0x0a,
+  0x12, 0x0e, 0x0c, 0x25, 0x70, 0x0a, 0x1d, 0x0b, 0x08, 0x0b, 0x16, 0x0b, 0x07, 0x25, 0x0a, 0x25,
+  0x10, 0x22, 0x0d, 0x0a, 0x0b, 0x0a, 0x12, 0x0e, 0x0d, 0x23, 0x71, 0x0a, 0x1d, 0x0b, 0x07, 0x0b,
+  0x17, 0x0c, 0x06, 0x25, 0x0a, 0x24, 0x12, 0x20, 0x0e, 0x0a, 0x0b, 0x0a, 0x13, 0x0d, 0x0e, 0x21,
+  0x72, 0x0a, 0x1d, 0x0b, 0x07, 0x0b, 0x18, 0x0b, 0x06, 0x25, 0x0a, 0x23, 0x14, 0x1e, 0x0f, 0x0a,
+  0x0b, 0x0a, 0x14, 0x0c, 0x0f, 0x1f, 0x73, 0x0a, 0x1d, 0x0b, 0x06, 0x0c, 0x18, 0x0c, 0x05, 0x25,
+  0x0a, 0x22, 0x16, 0x1b, 0x11, 0x0a, 0x0b, 0x0a, 0x15, 0x0b, 0x10, 0x1d, 0x74, 0x0a, 0x1e, 0x09,
+  0x08, 0x0a, 0x1a, 0x0a, 0x06, 0x25, 0x0a, 0x20, 0x19, 0x19, 0x13, 0x09, 0x0c, 0x09, 0x16, 0x09,
+  0x12, 0x1a, 0x8d, 0xe5, 0x22, 0x04, 0x1d, 0x05, 0x0f, 0x05, 0x19, 0x05, 0x0e, 0x05, 0x1d, 0x05,
+  0x21, 0x81, 0x14, 0x1e, 0x04, 0x1e, 0x04, 0x0f, 0x05, 0x19, 0x04, 0x0f, 0x05, 0x1d, 0x05, 0x1e,
+  0x81, 0x1f, 0x17, 0x04, 0x1d, 0x05, 0x0f, 0x04, 0x19, 0x04, 0x0f, 0x04, 0x1e, 0x04, 0x17, 0x81,
+  0x2e, 0x10, 0x04, 0x1e, 0x04, 0x0f, 0x04, 0x19, 0x04, 0x0f, 0x04, 0x1d, 0x05, 0x11, 0x81, 0x35,
+  0x0f, 0x05, 0x10, 0x02, 0x0b, 0x04, 0x0f, 0x04, 0x19, 0x04, 0x0e, 0x04, 0x0c, 0x02, 0x10, 0x04,
+  0x0f, 0x81, 0x38, 0x10, 0x04, 0x0e, 0x05, 0x0b, 0x04, 0x0f, 0x04, 0x17, 0x04, 0x0f, 0x04, 0x0c,
+  0x04, 0x0e, 0x04, 0x0f, 0x81, 0x39, 0x0f, 0x05, 0x0c, 0x03, 0x01, 0x02, 0x0b, 0x04, 0x0f, 0x05,
+  0x15, 0x05, 0x0e, 0x05, 0x0b, 0x07, 0x0b, 0x05, 0x0f, 0x81, 0x39, 0x10, 0x04, 0x0a, 0x03, 0x03,
+  0x03, 0x0b, 0x04, 0x0f, 0x07, 0x10, 0x06, 0x0f, 0x04, 0x0c, 0x02, 0x03, 0x03, 0x09, 0x05, 0x0f,
+  0x81, 0x3b, 0x0f, 0x05, 0x07, 0x04, 0x05, 0x02, 0x0c, 0x04, 0x0f, 0x08, 0x0c, 0x07, 0x0f, 0x04,
+  0x0c, 0x02, 0x06, 0x03, 0x07, 0x05, 0x0f, 0x81, 0x3b, 0x10, 0x04, 0x05, 0x04, 0x07, 0x03, 0x0b,
+  0x04, 0x10, 0x19, 0x0f, 0x04, 0x0d, 0x02, 0x07, 0x04, 0x04, 0x05, 0x0f, 0x81, 0x3d, 0x0f, 0x05,
+  0x03, 0x03, 0x08, 0x05, 0x0b, 0x04, 0x0f, 0x19, 0x0f, 0x04, 0x0c, 0x04, 0x08, 0x03, 0x03, 0x04,
+  0x10, 0x81, 0x3d, 0x10, 0x08, 0x08, 0x03, 0x02, 0x02, 0x0c, 0x04, 0x0f, 0x17, 0x0f, 0x04, 0x0c,
+  0x02, 0x02, 0x03, 0x08, 0x08, 0x0f, 0x81, 0x3f, 0x10, 0x06, 0x08, 0x02, 0x05, 0x02, 0x0c, 0x04,
+  0x0d, 0x19, 0x0d, 0x04, 0x0c, 0x03, 0x03, 0x03, 0x08, 0x06, 0x10, 0x81, 0x3f, 0x10, 0x05, 0x07,
+  0x03, 0x07, 0x02, 0x0c, 0x02, 0x0d, 0x08, 0x0b, 0x08, 0x0c, 0x03, 0x0c, 0x03, 0x06, 0x03, 0x07,
+  0x05, 0x0f, 0x81, 0x41, 0x10, 0x05, 0x05, 0x03, 0x07, 0x04, 0x05, 0x03, 0x11, 0x07, 0x10, 0x07,
+  0x10, 0x03, 0x05, 0x04, 0x07, 0x03, 0x05, 0x05, 0x10, 0x81, 0x41, 0x11, 0x05, 0x02, 0x03, 0x08,
+  0x06, 0x03, 0x03, 0x10, 0x07, 0x14, 0x06, 0x10, 0x03, 0x03, 0x06, 0x08, 0x03, 0x02, 0x05, 0x10,
+  0x81, 0x43, 0x10, 0x09, 0x08, 0x02, 0x04, 0x02, 0x01, 0x03, 0x10, 0x06, 0x18, 0x05, 0x10, 0x02,
+  0x02, 0x03, 0x03, 0x02, 0x08, 0x08, 0x11, 0x81, 0x43, 0x11, 0x06, 0x09, 0x02, 0x06, 0x04, 0x11,
+  0x05, 0x1a, 0x05, 0x10, 0x05, 0x05, 0x02, 0x08, 0x07, 0x10, 0x81, 0x45, 0x11, 0x05, 0x08, 0x02,
+  0x07, 0x03, 0x11, 0x05, 0x03, 0x01, 0x18, 0x05, 0x10, 0x03, 0x07, 0x02, 0x08, 0x05, 0x10, 0x81,
+  0x47, 0x11, 0x05, 0x07, 0x01, 0x08, 0x02, 0x11, 0x05, 0x04, 0x02, 0x18, 0x04, 0x11, 0x02, 0x08,
+  0x02, 0x06, 0x05, 0x11, 0x81, 0x47, 0x12, 0x05, 0x0e, 0x03, 0x10, 0x05, 0x05, 0x03, 0x18, 0x04,
+  0x11, 0x02, 0x0e, 0x05, 0x11, 0x81, 0x49, 0x11, 0x05, 0x0d, 0x03, 0x11, 0x04, 0x07, 0x03, 0x17,
+  0x04, 0x12, 0x02, 0x0c, 0x05, 0x11, 0x81, 0x4b, 0x11, 0x05, 0x0b, 0x03, 0x11, 0x05, 0x08, 0x03,
+  0x17, 0x04, 0x12, 0x02, 0x0b, 0x05, 0x11, 0x81, 0x4c, 0x11, 0x06, 0x08, 0x03, 0x12, 0x04, 0x0a,
+  0x02, 0x17, 0x04, 0x13, 0x02, 0x09, 0x05, 0x11, 0x81, 0x4d, 0x12, 0x05, 0x07, 0x03, 0x12, 0x05,
+  0x0b, 0x02, 0x17, 0x04, 0x12, 0x03, 0x06, 0x06, 0x11, 0x81, 0x4f, 0x12, 0x06, 0x04, 0x03, 0x13,
+  0x04, 0x0d, 0x02, 0x16, 0x04, 0x13, 0x03, 0x04, 0x06, 0x12, 0x81, 0x50, 0x12, 0x06, 0x02, 0x03,
+  0x14, 0x04, 0x0e, 0x02, 0x16, 0x03, 0x14, 0x03, 0x02, 0x06, 0x12, 0x81, 0x52, 0x12, 0x09, 0x15,
+  0x03, 0x10, 0x07, 0x10, 0x04, 0x14, 0x09, 0x12, 0x81, 0x53, 0x13, 0x07, 0x15, 0x04, 0x10, 0x02,
+  0x04, 0x02, 0x0f, 0x04, 0x15, 0x07, 0x12, 0x81, 0x55, 0x14, 0x06, 0x14, 0x04, 0x0f, 0x02, 0x06,
+  0x02, 0x0e, 0x04, 0x14, 0x06, 0x13, 0x81, 0x57, 0x14, 0x06, 0x13, 0x04, 0x0f, 0x01, 0x08, 0x01,
+  0x0e, 0x04, 0x13, 0x06, 0x14, 0x81, 0x58, 0x14, 0x06, 0x12, 0x04, 0x0f, 0x01, 0x08, 0x02, 0x0d,
+  0x04, 0x12, 0x06, 0x14, 0x81, 0x5a, 0x14, 0x07, 0x10, 0x04, 0x0f, 0x01, 0x08, 0x02, 0x0d, 0x04,
+  0x10, 0x07, 0x14, 0x81, 0x5c, 0x15, 0x07, 0x0e, 0x04, 0x0f, 0x01, 0x08, 0x01, 0x0e, 0x04, 0x0e,
+  0x07, 0x15, 0x81, 0x5e, 0x15, 0x07, 0x0d, 0x04, 0x0f, 0x02, 0x06, 0x02, 0x0e, 0x04, 0x0d, 0x07,
+  0x15, 0x81, 0x60, 0x16, 0x07, 0x0b, 0x04, 0x10, 0x02, 0x04, 0x02, 0x0f, 0x04, 0x0b, 0x07, 0x16,
+  0x81, 0x62, 0x16, 0x08, 0x0a, 0x03, 0x11, 0x07, 0x0f, 0x04, 0x09, 0x08, 0x16, 0x81, 0x64, 0x17,
+  0x08, 0x08, 0x04, 0x12, 0x03, 0x11, 0x04, 0x07, 0x08, 0x17, 0x81, 0x66, 0x17, 0x09, 0x06, 0x04,
+  0x25, 0x04, 0x06, 0x09, 0x17, 0x81, 0x68, 0x18, 0x0a, 0x03, 0x04, 0x25, 0x04, 0x03, 0x0a, 0x17,
+  0x81, 0x6b, 0x19, 0x10, 0x24, 0x0f, 0x18, 0x81, 0x6e, 0x1a, 0x0d, 0x23, 0x0d, 0x1a, 0x81, 0x70,
+  0x1b, 0x0c, 0x22, 0x0b, 0x1b, 0x81, 0x72, 0x1d, 0x09, 0x21, 0x09, 0x1d, 0x81, 0x74, 0x1f, 0x07,
+  0x1f, 0x07, 0x1e, 0x81, 0x78, 0x20, 0x05, 0x1e, 0x04, 0x20, 0x81, 0x7a, 0x20, 0x05, 0x1c, 0x04,
+  0x1f, 0x81, 0x7e, 0x1f, 0x05, 0x19, 0x06, 0x1e, 0x81, 0x80, 0x1f, 0x05, 0x17, 0x06, 0x1d, 0x81,
+  0x84, 0x1e, 0x06, 0x14, 0x06, 0x1d, 0x81, 0x87, 0x1d, 0x07, 0x10, 0x07, 0x1c, 0x81, 0x8b, 0x1c,
+  0x08, 0x0b, 0x08, 0x1c, 0x81, 0x8f, 0x1c, 0x18, 0x1b, 0x81, 0x93, 0x1b, 0x15, 0x1b, 0x81, 0x97,
+  0x1c, 0x0f, 0x1c, 0x81, 0x9b, 0x1e, 0x07, 0x1d, 0x81, 0xa1, 0x3d, 0x81, 0xa7, 0x35, 0x81, 0xae,
+  0x2e, 0x81, 0xb6, 0x26, 0x81, 0xc0, 0x1b, 0xff, 0xff, 0x00, 0x84, 0x25, 0xff, 0xff, 0x00, 0xb5,
+  0x36, 0x02, 0x81, 0xdd, 0x05, 0x81, 0xda, 0x07, 0x81, 0xd8, 0x09, 0x81, 0xd6, 0x0b, 0x81, 0xd4,
+  0x0c, 0x81, 0xd3, 0x0d, 0x81, 0xd4, 0x0d, 0x0a, 0x07, 0x81, 0xc3, 0x1e, 0x81, 0xc3, 0x1e, 0x81,
+  0xc3, 0x1e, 0x81, 0xc2, 0x27, 0x04, 0x03, 0x81, 0xa8, 0x04, 0x05, 0x30, 0x81, 0xa6, 0x3c, 0x81,
+  0xa3, 0x3f, 0x80, 0xe0, 0x81, 0x00, 0x03, 0x02, 0x0b, 0x22, 0x80, 0xab, 0x81, 0x08, 0x0a, 0x26,
+  0x80, 0xa6, 0x81, 0x0a, 0x0a, 0x27, 0x80, 0xa4, 0x81, 0x0b, 0x09, 0x28, 0x80, 0xa3, 0x81, 0x07,
+  0x04, 0x01, 0x09, 0x28, 0x80, 0xa2, 0x81, 0x08, 0x0e, 0x28, 0x80, 0xa2, 0x15, 0x80, 0xb4, 0x3c,
+  0x24, 0x15, 0x80, 0xa1, 0x11, 0x80, 0xbb, 0x38, 0x2a, 0x11, 0x80, 0xa1, 0x0e, 0x80, 0xbf, 0x02,
+  0x06, 0x29, 0x04, 0x01, 0x2d, 0x0e, 0x80, 0xa1, 0x0e, 0x80, 0xca, 0x1d, 0x3d, 0x0d, 0x80, 0xa1,
+  0x0d, 0x80, 0xcd, 0x1a, 0x3e, 0x0d, 0x80, 0xa1, 0x0c, 0x80, 0xcf, 0x19, 0x3e, 0x0c, 0x80, 0xa1,
+  0x0c, 0x80, 0xd1, 0x09, 0x4d, 0x0c, 0x80, 0xa1, 0x0c, 0x80, 0xd2, 0x02, 0x53, 0x0c, 0x80, 0xa0,
+  0x0c, 0x81, 0x28, 0x0b, 0x80, 0xa1, 0x0c, 0x81, 0x27, 0x0c, 0x80, 0xa1, 0x0b, 0x81, 0x28, 0x0b,
+  0x80, 0xa1, 0x0c, 0x81, 0x27, 0x0c, 0x80, 0xa1, 0x0b, 0x12, 0x01, 0x80, 0xfd, 0x01, 0x17, 0x0c,
+  0x80, 0xa1, 0x0b, 0x0c, 0x0c, 0x0d, 0x0d, 0x12, 0x12, 0x0a, 0x12, 0x0a, 0x10, 0x16, 0x07, 0x0f,
+  0x06, 0x0a, 0x07, 0x0a, 0x06, 0x13, 0x06, 0x12, 0x0c, 0x12, 0x0b, 0x80, 0xa1, 0x0c, 0x0a, 0x0f,
+  0x0b, 0x11, 0x0e, 0x13, 0x09, 0x13, 0x09, 0x14, 0x12, 0x08, 0x0f, 0x06, 0x09, 0x07, 0x0b, 0x06,
+  0x13, 0x06, 0x0f, 0x11, 0x0f, 0x0c, 0x80, 0xa1, 0x0b, 0x0a, 0x11, 0x0a, 0x12, 0x0d, 0x13, 0x09,
+  0x12, 0x0a, 0x16, 0x10, 0x07, 0x0f, 0x06, 0x0a, 0x07, 0x0a, 0x07, 0x12, 0x06, 0x0e, 0x14, 0x0e,
+  0x0b, 0x80, 0xa1, 0x0c, 0x08, 0x12, 0x0a, 0x14, 0x0c, 0x12, 0x09, 0x13, 0x09, 0x18, 0x0f, 0x07,
+  0x0f, 0x06, 0x0a, 0x07, 0x0a, 0x07, 0x12, 0x06, 0x0d, 0x16, 0x0d, 0x0b, 0x80, 0xa1, 0x0c, 0x08,
+  0x09, 0x04, 0x04, 0x0b, 0x15, 0x0a, 0x13, 0x09, 0x13, 0x09, 0x19, 0x0d, 0x07, 0x0f, 0x07, 0x09,
+  0x07, 0x0b, 0x08, 0x10, 0x06, 0x0c, 0x18, 0x0c, 0x0c, 0x80, 0xa1, 0x0b, 0x08, 0x08, 0x08, 0x01,
+  0x0b, 0x07, 0x06, 0x09, 0x0a, 0x07, 0x14, 0x07, 0x15, 0x07, 0x09, 0x0a, 0x0d, 0x07, 0x0f, 0x06,
+  0x0a, 0x07, 0x0a, 0x09, 0x10, 0x06, 0x0b, 0x09, 0x07, 0x0a, 0x0b, 0x0b, 0x80, 0xa1, 0x0c, 0x07,
+  0x08, 0x15, 0x07, 0x07, 0x08, 0x09, 0x07, 0x15, 0x07, 0x15, 0x07, 0x0b, 0x09, 0x0b, 0x07, 0x0f,
+  0x07, 0x09, 0x07, 0x0b, 0x09, 0x0f, 0x07, 0x0a, 0x08, 0x0b, 0x08, 0x0a, 0x0c, 0x80, 0xa1, 0x0b,
+  0x07, 0x08, 0x16, 0x07, 0x08, 0x07, 0x09, 0x07, 0x15, 0x07, 0x15, 0x07, 0x0c, 0x08, 0x0b, 0x07,
+  0x0f, 0x06, 0x0a, 0x07, 0x0a, 0x0b, 0x0e, 0x06, 0x0a, 0x08, 0x0d, 0x08, 0x09, 0x0c, 0x80, 0xa0,
+  0x0c, 0x07, 0x07, 0x16, 0x07, 0x09, 0x07, 0x08, 0x07, 0x15, 0x07, 0x15, 0x07, 0x0d, 0x08, 0x0b,
+  0x07, 0x0f, 0x06, 0x0a, 0x06, 0x0b, 0x0b, 0x0e, 0x06, 0x09, 0x07, 0x0f, 0x08, 0x09, 0x0b, 0x80,
+  0xa1, 0x0c, 0x07, 0x07, 0x16, 0x07, 0x09, 0x07, 0x08, 0x07, 0x15, 0x07, 0x15, 0x07, 0x0e, 0x08,
+  0x09, 0x07, 0x0f, 0x06, 0x0a, 0x07, 0x0a, 0x0c, 0x0d, 0x06, 0x09, 0x07, 0x10, 0x08, 0x08, 0x0c,
+  0x80, 0xa1, 0x0b, 0x08, 0x07, 0x15, 0x07, 0x0a, 0x07, 0x07, 0x07, 0x15, 0x07, 0x15, 0x07, 0x0f,
+  0x08, 0x09, 0x07, 0x0f, 0x06, 0x0a, 0x07, 0x0a, 0x0c, 0x0d, 0x06, 0x08, 0x07, 0x12, 0x07, 0x08,
+  0x0b, 0x80, 0xa1, 0x0c, 0x08, 0x07, 0x15, 0x07, 0x0a, 0x07, 0x07, 0x07, 0x15, 0x07, 0x15, 0x07,
+  0x0f, 0x08, 0x08, 0x07, 0x0f, 0x06, 0x0a, 0x07, 0x0b, 0x05, 0x01, 0x07, 0x0b, 0x06, 0x08, 0x07,
+  0x13, 0x07, 0x08, 0x0b, 0x80, 0xa1, 0x0b, 0x09, 0x07, 0x14, 0x07, 0x0a, 0x07, 0x08, 0x07, 0x14,
+  0x08, 0x14, 0x07, 0x10, 0x08, 0x08, 0x07, 0x0f, 0x06, 0x0a, 0x07, 0x0a, 0x06, 0x01, 0x07, 0x0b,
+  0x06, 0x07, 0x08, 0x13, 0x07, 0x07, 0x0c, 0x80, 0xa1, 0x0b, 0x09, 0x08, 0x13, 0x07, 0x0a, 0x07,
+  0x07, 0x07, 0x15, 0x07, 0x15, 0x07, 0x10, 0x07, 0x08, 0x07, 0x0f, 0x07, 0x09, 0x07, 0x0b, 0x05,
+  0x03, 0x06, 0x0b, 0x05, 0x08, 0x07, 0x13, 0x08, 0x07, 0x0b, 0x80, 0xa1, 0x0c, 0x09, 0x08, 0x12,
+  0x07, 0x0a, 0x08, 0x07, 0x07, 0x15, 0x07, 0x14, 0x07, 0x11, 0x07, 0x08, 0x07, 0x0f, 0x06, 0x0a,
+  0x07, 0x0a, 0x06, 0x03, 0x07, 0x09, 0x06, 0x07, 0x07, 0x14, 0x08, 0x07, 0x0b, 0x80, 0xa1, 0x0b,
+  0x0a, 0x09, 0x11, 0x07, 0x09, 0x08, 0x07, 0x07, 0x15, 0x07, 0x15, 0x07, 0x11, 0x07, 0x08, 0x06,
+  0x10, 0x06, 0x09, 0x07, 0x0b, 0x06, 0x03, 0x07, 0x09, 0x06, 0x07, 0x07, 0x14, 0x07, 0x07, 0x0c,
+  0x80, 0xa1, 0x0b, 0x0b, 0x08, 0x11, 0x07, 0x09, 0x07, 0x08, 0x12, 0x0a, 0x12, 0x0a, 0x07, 0x10,
+  0x08, 0x07, 0x07, 0x0f, 0x06, 0x0a, 0x07, 0x0a, 0x06, 0x04, 0x07, 0x08, 0x06, 0x07, 0x07, 0x15,
+  0x07, 0x07, 0x0b, 0x80, 0xa1, 0x0c, 0x0b, 0x09, 0x0f, 0x07, 0x08, 0x08, 0x08, 0x13, 0x09, 0x13,
+  0x09, 0x07, 0x11, 0x08, 0x07, 0x07, 0x0f, 0x06, 0x09, 0x07, 0x0b, 0x06, 0x04, 0x07, 0x08, 0x06,
+  0x07, 0x07, 0x14, 0x08, 0x06, 0x0c, 0x80, 0xa1, 0x0b, 0x0d, 0x08, 0x0f, 0x07, 0x07, 0x08, 0x09,
+  0x12, 0x0a, 0x12, 0x0a, 0x07, 0x11, 0x07, 0x07, 0x07, 0x0f, 0x06, 0x0a, 0x07, 0x0a, 0x06, 0x06,
+  0x07, 0x06, 0x06, 0x07, 0x07, 0x15, 0x08, 0x06, 0x0b, 0x80, 0xa1, 0x0c, 0x0d, 0x09, 0x0d, 0x07,
+  0x03, 0x0c, 0x0a, 0x12, 0x09, 0x13, 0x09, 0x07, 0x11, 0x08, 0x07, 0x07, 0x0f, 0x06, 0x0a, 0x07,
+  0x0a, 0x06, 0x06, 0x07, 0x06, 0x06, 0x07, 0x07, 0x15, 0x07, 0x07, 0x0b, 0x80, 0xa1, 0x0b, 0x0f,
+  0x08, 0x0d, 0x07, 0x02, 0x0c, 0x0a, 0x12, 0x0a, 0x12, 0x0a, 0x07, 0x11, 0x08, 0x06, 0x07, 0x0f,
+  0x07, 0x09, 0x07, 0x0b, 0x05, 0x07, 0x07, 0x06, 0x05, 0x07, 0x08, 0x14, 0x08, 0x06, 0x0c, 0x80,
+  0xa1, 0x0b, 0x0f, 0x09, 0x0b, 0x07, 0x03, 0x0a, 0x0c, 0x07, 0x15, 0x07, 0x14, 0x07, 0x11, 0x08,
+  0x07, 0x07, 0x0f, 0x06, 0x0a, 0x07, 0x0a, 0x06, 0x07, 0x07, 0x05, 0x06, 0x07, 0x07, 0x15, 0x07,
+  0x07, 0x0b, 0x80, 0xa1, 0x0c, 0x10, 0x08, 0x0b, 0x07, 0x02, 0x08, 0x0e, 0x07, 0x15, 0x07, 0x15,
+  0x07, 0x11, 0x07, 0x08, 0x06, 0x10, 0x06, 0x09, 0x07, 0x0b, 0x06, 0x08, 0x07, 0x04, 0x06, 0x07,
+  0x07, 0x15, 0x07, 0x06, 0x0c, 0x80, 0xa1, 0x0b, 0x11, 0x08, 0x0b, 0x07, 0x02, 0x05, 0x11, 0x07,
+  0x15, 0x07, 0x15, 0x07, 0x10, 0x08, 0x07, 0x07, 0x0f, 0x06, 0x0a, 0x07, 0x0a, 0x06, 0x09, 0x07,
+  0x03, 0x06, 0x08, 0x07, 0x14, 0x07, 0x07, 0x0c, 0x80, 0xa0, 0x0c, 0x12, 0x08, 0x09, 0x07, 0x18,
+  0x07, 0x15, 0x07, 0x15, 0x07, 0x10, 0x08, 0x08, 0x07, 0x0f, 0x06, 0x0a, 0x07, 0x0a, 0x06, 0x09,
+  0x07, 0x03, 0x06, 0x07, 0x08, 0x13, 0x08, 0x07, 0x0b, 0x80, 0xa1, 0x0c, 0x12, 0x08, 0x09, 0x07,
+  0x18, 0x07, 0x15, 0x07, 0x15, 0x07, 0x10, 0x08, 0x07, 0x07, 0x0f, 0x06, 0x0a, 0x07, 0x0a, 0x06,
+  0x0b, 0x06, 0x03, 0x05, 0x08, 0x08, 0x13, 0x07, 0x07, 0x0c, 0x80, 0xa1, 0x0b, 0x13, 0x08, 0x08,
+  0x07, 0x19, 0x07, 0x14, 0x07, 0x15, 0x07, 0x10, 0x08, 0x08, 0x07, 0x0f, 0x06, 0x0a, 0x07, 0x0a,
+  0x06, 0x0b, 0x07, 0x01, 0x06, 0x08, 0x08, 0x12, 0x08, 0x07, 0x0b, 0x80, 0xa1, 0x0c, 0x13, 0x08,
+  0x08, 0x07, 0x18, 0x07, 0x15, 0x07, 0x15, 0x07, 0x0f, 0x08, 0x09, 0x07, 0x0e, 0x06, 0x0a, 0x07,
+  0x0b, 0x05, 0x0c, 0x07, 0x01, 0x05, 0x09, 0x08, 0x11, 0x08, 0x08, 0x0b, 0x80, 0xa1, 0x0b, 0x14,
+  0x07, 0x08, 0x08, 0x18, 0x07, 0x15, 0x07, 0x15, 0x07, 0x0e, 0x08, 0x09, 0x07, 0x0e, 0x07, 0x0a,
+  0x07, 0x0a, 0x06, 0x0c, 0x0d, 0x09, 0x08, 0x11, 0x07, 0x08, 0x0c, 0x80, 0xa1, 0x0b, 0x14, 0x07,
+  0x08, 0x07, 0x18, 0x07, 0x15, 0x07, 0x15, 0x07, 0x0d, 0x09, 0x0a, 0x07, 0x0d, 0x07, 0x0a, 0x07,
+  0x0b, 0x06, 0x0d, 0x0c, 0x09, 0x08, 0x10, 0x07, 0x09, 0x0b, 0x80, 0xa1, 0x0c, 0x13, 0x08, 0x08,
+  0x07, 0x18, 0x07, 0x15, 0x07, 0x15, 0x07, 0x0c, 0x09, 0x0b, 0x07, 0x0d, 0x06, 0x0b, 0x07, 0x0a,
+  0x06, 0x0e, 0x0b, 0x0a, 0x08, 0x0f, 0x07, 0x09, 0x0c, 0x80, 0xa1, 0x0b, 0x14, 0x07, 0x08, 0x07,
+  0x18, 0x07, 0x15, 0x07, 0x15, 0x07, 0x0b, 0x0a, 0x0c, 0x08, 0x0b, 0x07, 0x0b, 0x07, 0x0a, 0x06,
+  0x0e, 0x0b, 0x0b, 0x08, 0x0c, 0x08, 0x0a, 0x0b, 0x80, 0xa1, 0x0c, 0x06, 0x02, 0x0b, 0x08, 0x08,
+  0x07, 0x18, 0x07, 0x15, 0x07, 0x15, 0x07, 0x09, 0x0b, 0x0d, 0x08, 0x09, 0x08, 0x0b, 0x07, 0x0a,
+  0x06, 0x10, 0x09, 0x0c, 0x09, 0x0a, 0x08, 0x0b, 0x0b, 0x80, 0xa1, 0x0b, 0x06, 0x05, 0x07, 0x09,
+  0x08, 0x07, 0x18, 0x07, 0x15, 0x07, 0x15, 0x07, 0x07, 0x0d, 0x0e, 0x09, 0x06, 0x09, 0x0c, 0x07,
+  0x0a, 0x06, 0x10, 0x09, 0x0c, 0x0a, 0x06, 0x0a, 0x0b, 0x0c, 0x80, 0xa1, 0x0b, 0x05, 0x08, 0x03,
+  0x0a, 0x09, 0x07, 0x18, 0x15, 0x07, 0x15, 0x07, 0x19, 0x10, 0x17, 0x0c, 0x07, 0x0a, 0x07, 0x10,
+  0x08, 0x0e, 0x18, 0x0c, 0x0b, 0x80, 0xa1, 0x0c, 0x05, 0x14, 0x09, 0x07, 0x19, 0x14, 0x08, 0x14,
+  0x07, 0x18, 0x13, 0x14, 0x0e, 0x07, 0x0a, 0x06, 0x11, 0x08, 0x0f, 0x16, 0x0c, 0x0c, 0x80, 0xa1,
+  0x0b, 0x06, 0x13, 0x0a, 0x07, 0x18, 0x15, 0x07, 0x15, 0x07, 0x16, 0x15, 0x13, 0x0e, 0x07, 0x0b,
+  0x06, 0x12, 0x07, 0x0f, 0x14, 0x0e, 0x0c, 0x80, 0xa1, 0x0b, 0x07, 0x10, 0x0c, 0x07, 0x18, 0x15,
+  0x07, 0x14, 0x08, 0x13, 0x19, 0x10, 0x10, 0x07, 0x0a, 0x06, 0x13, 0x06, 0x12, 0x10, 0x10, 0x0b,
+  0x80, 0xa1, 0x0c, 0x09, 0x0c, 0x0d, 0x07, 0x18, 0x15, 0x07, 0x15, 0x07, 0x0f, 0x20, 0x0c, 0x12,
+  0x06, 0x0b, 0x06, 0x14, 0x05, 0x13, 0x0c, 0x12, 0x0c, 0x80, 0xa1, 0x0b, 0x0f, 0x01, 0x80, 0x9e,
+  0x01, 0x61, 0x01, 0x17, 0x0b, 0x80, 0xa1, 0x0c, 0x81, 0x28, 0x0b, 0x80, 0xa1, 0x0c, 0x81, 0x27,
+  0x0c, 0x80, 0xa1, 0x0b, 0x81, 0x28, 0x0b, 0x80, 0xa1, 0x0c, 0x81, 0x27, 0x0c, 0x80, 0xa1, 0x0b,
+  0x81, 0x28, 0x0c, 0x80, 0xa0, 0x0c, 0x33, 0x04, 0x80, 0xf1, 0x0b, 0x80, 0xa1, 0x0c, 0x33, 0x04,
+  0x80, 0xf0, 0x0c, 0x80, 0xa1, 0x0c, 0x25, 0x02, 0x01, 0x07, 0x03, 0x06, 0x80, 0xee, 0x0c, 0x80,
+  0xa1, 0x0d, 0x24, 0x15, 0x80, 0xec, 0x0d, 0x80, 0xa1, 0x0d, 0x24, 0x16, 0x80, 0xea, 0x0e, 0x80,
+  0xa1, 0x0e, 0x15, 0x2b, 0x80, 0xe2, 0x0e, 0x80, 0xa1, 0x11, 0x12, 0x3d, 0x80, 0xce, 0x11, 0x80,
+  0xa1, 0x15, 0x0e, 0x3e, 0x80, 0xc8, 0x15, 0x80, 0xa2, 0x21, 0x02, 0x42, 0x01, 0x80, 0xd8, 0x80,
+  0xa2, 0x1f, 0x04, 0x81, 0x1a, 0x80, 0xa3, 0x1e, 0x04, 0x81, 0x1a, 0x80, 0xa5, 0x1d, 0x01, 0x01,
+  0x01, 0x81, 0x1a, 0x80, 0xa7, 0x1c, 0x01, 0x01, 0x03, 0x81, 0x16, 0x80, 0xab, 0x1a, 0x01, 0x01,
+  0x03, 0x81, 0x13, 0x80, 0xc9, 0x01, 0x03, 0x3e, 0x81, 0x9e, 0x41, 0x81, 0xa1, 0x2e, 0x0c, 0x01,
+  0x81, 0xa9, 0x23, 0x81, 0xca, 0x16, 0x81, 0xcb, 0x0b, 0x02, 0x06, 0x41, 0x04, 0x0d, 0x01, 0x2e,
+  0x04, 0x11, 0x01, 0x10, 0x01, 0x0e, 0x02, 0x03, 0x01, 0x04, 0x01, 0x04, 0x05, 0x01, 0x04, 0x08,
+  0x01, 0x02, 0x01, 0x01, 0x02, 0x03, 0x01, 0x03, 0x03, 0x80, 0xf3, 0x04, 0x42, 0x01, 0x02, 0x01,
+  0x0c, 0x01, 0x2f, 0x01, 0x03, 0x01, 0x10, 0x01, 0x10, 0x01, 0x0e, 0x02, 0x02, 0x02, 0x03, 0x03,
+  0x06, 0x01, 0x02, 0x01, 0x03, 0x01, 0x02, 0x01, 0x04, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x01,
+  0x01, 0x02, 0x03, 0x01, 0x80, 0xf2, 0x04, 0x42, 0x01, 0x02, 0x01, 0x02, 0x04, 0x02, 0x02, 0x01,
+  0x02, 0x02, 0x04, 0x02, 0x02, 0x02, 0x07, 0x02, 0x01, 0x01, 0x02, 0x02, 0x04, 0x02, 0x03, 0x02,
+  0x04, 0x05, 0x01, 0x04, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x04, 0x02, 0x01, 0x02,
+  0x01, 0x01, 0x01, 0x02, 0x01, 0x08, 0x04, 0x02, 0x01, 0x02, 0x01, 0x05, 0x02, 0x02, 0x02, 0x03,
+  0x01, 0x01, 0x01, 0x05, 0x01, 0x03, 0x01, 0x04, 0x01, 0x01, 0x01, 0x06, 0x01, 0x02, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 0x01, 0x81, 0x38, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03, 0x01,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x01, 0x02, 0x01, 0x03, 0x01, 0x02, 0x01,
+  0x05, 0x01, 0x05, 0x01, 0x01, 0x01, 0x05, 0x01, 0x02, 0x01, 0x05, 0x01, 0x03, 0x01, 0x02, 0x01,
+  0x02, 0x01, 0x04, 0x01, 0x02, 0x01, 0x02, 0x01, 0x05, 0x01, 0x01, 0x01, 0x02, 0x01, 0x05, 0x01,
+  0x05, 0x01, 0x02, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01,
+  0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x02, 0x01, 0x04, 0x01, 0x81, 0x38, 0x01, 0x04, 0x01, 0x05, 0x01, 0x03, 0x01, 0x02,
+  0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x06, 0x01, 0x02, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x01, 0x04, 0x02, 0x07, 0x01, 0x04, 0x01, 0x02, 0x01, 0x02, 0x03, 0x01, 0x01, 0x03, 0x01, 0x04,
+  0x04, 0x04, 0x01, 0x06, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x05, 0x01, 0x02, 0x01, 0x02,
+  0x01, 0x02, 0x01, 0x02, 0x01, 0x03, 0x01, 0x05, 0x01, 0x03, 0x01, 0x02, 0x01, 0x03, 0x01, 0x02,
+  0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x01, 0x81, 0x37, 0x01, 0x05, 0x01, 0x05, 0x01,
+  0x03, 0x01, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x04, 0x01, 0x08, 0x01, 0x03, 0x02, 0x02, 0x01,
+  0x04, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x03, 0x02, 0x05, 0x02,
+  0x02, 0x01, 0x02, 0x02, 0x06, 0x01, 0x02, 0x01, 0x04, 0x01, 0x03, 0x01, 0x02, 0x01, 0x05, 0x01,
+  0x03, 0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 0x02, 0x02, 0x01, 0x03, 0x01,
+  0x81, 0x38, 0x01, 0x06, 0x03, 0x02, 0x01, 0x03, 0x01, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x02,
+  0x01, 0x05, 0x04, 0x02, 0x01, 0x02, 0x01, 0x03, 0x03, 0x02, 0x03, 0x05, 0x04, 0x03, 0x01, 0x02,
+  0x03, 0x02, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x01, 0x06, 0x04, 0x04, 0x01, 0x06, 0x01, 0x04,
+  0x01, 0x02, 0x01, 0x04, 0x07, 0x01, 0x05, 0x03, 0x04, 0x02, 0x01, 0x02, 0x01, 0x03, 0x02, 0x02,
+  0x04, 0x81, 0x88, 0x01, 0x0f, 0x01, 0x0d, 0x01, 0x81, 0xc1, 0x01, 0x0d, 0x02, 0x0d, 0x01, 0xff,
+  0xff, 0x00, 0xdc, 0x09,
+};
+
+#endif
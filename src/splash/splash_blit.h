@@ -0,0 +1,149 @@
+/**
+ * @file splash_blit.h
+ * @brief Fast blit of the packed 1-bit splash logos
+ *
+ * Drawing a logo with drawPixel() opens an address window per pixel, 153,600
+ * of them for a full screen, which takes over a second of SPI. Instead the
+ * whole image goes out as one window through the DMA push path, each chunk
+ * of scanlines decoded from its run-length stream (splash_pack.h) while the
+ * previous one is on the wire. Runs are written with memset()/memcpy(), so
+ * the long black stretches cost next to nothing to expand.
+ *
+ * When both colours are among the panel's eight primaries (white on black
+ * is), the ILI9488 is switched to its 3-bit interface format (COLMOD 0x01)
+ * for the push: two pixels per byte, so a full screen is 76.8 KB, about
+ * 31 ms at 20 MHz, instead of 460 KB and 184 ms as RGB666. Other colours go
+ * out as RGB666. Without the DMA buffers (or for a display other than
+ * `display`) it falls back to one pushImage() per scanline.
+ */
+
+#ifndef SPLASH_BLIT_H
+#define SPLASH_BLIT_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "../dma_push.h"
+#include "splash_pack.h"
+
+#define SPLASH_BLIT_MAX_W 480  // line buffer for the fallback path
+
+#define ILI9488_COLMOD 0x3A
+#define COLMOD_3BIT 0x01
+#define COLMOD_18BIT 0x66  // what TFT_eSPI's ILI9488 init sets
+
+struct SplashRgb666Source {
+  SplashRunReader runs;
+  uint8_t colors[2][3];  // clear, set
+};
+
+static void dmaFillFromRuns(uint8_t* dst, int16_t line, int16_t lines, int16_t width, void* ctx) {
+  (void)line;
+  SplashRgb666Source* src = (SplashRgb666Source*)ctx;
+  SplashRunReader& r = src->runs;
+  uint32_t count = (uint32_t)lines * width;
+  while (count) {
+    r.fill();
+    uint32_t n = (r.left < count) ? r.left : count;
+    const uint8_t* c = src->colors[r.color];
+    if (c[0] == c[1] && c[1] == c[2]) {
+      memset(dst, c[0], n * 3);  // black and white
+      dst += n * 3;
+    } else {
+      for (uint32_t i = 0; i < n; i++, dst += 3) memcpy(dst, c, 3);
+    }
+    r.left -= n;
+    count -= n;
+  }
+}
+
+struct Splash3BitSource {
+  SplashRunReader runs;
+  uint8_t pairs[4];  // two 3-bit pixels per byte, for each pair of bitmap bits
+};
+
+static void dmaFillFromRuns3Bit(uint8_t* dst, int16_t line, int16_t lines, int16_t width, void* ctx) {
+  (void)line;
+  Splash3BitSource* src = (Splash3BitSource*)ctx;
+  SplashRunReader& r = src->runs;
+  uint8_t* end = dst + (uint32_t)lines * width / 2;
+  while (dst < end) {
+    r.fill();
+    if (r.left >= 2) {
+      uint32_t n = r.left / 2;
+      if (n > (uint32_t)(end - dst)) n = end - dst;
+      memset(dst, src->pairs[r.color ? 3 : 0], n);
+      dst += n;
+      r.left -= n * 2;
+    } else {  // a run boundary inside the byte
+      uint8_t first = r.pixel();
+      *dst++ = src->pairs[(first << 1) | r.pixel()];
+    }
+  }
+}
+
+// RGB565 colour as a 3-bit interface pixel, or -1 if it isn't one of the 8 it can show
+static int8_t splash3BitColor(uint16_t c) {
+  uint16_t r = c & 0xF800, g = c & 0x07E0, b = c & 0x001F;
+  if ((r && r != 0xF800) || (g && g != 0x07E0) || (b && b != 0x001F)) return -1;
+  return (int8_t)((r ? 4 : 0) | (g ? 2 : 0) | (b ? 1 : 0));
+}
+
+/**
+ * @brief Draw a packed splash image
+ * @param tft Display to draw on
+ * @param asset Image from the splash pack
+ * @param x X position
+ * @param y Y position
+ * @param color Colour of set pixels
+ * @param bg Colour of clear pixels
+ */
+inline void splashBlitPacked(TFT_eSPI& tft, const SplashAsset& asset, int16_t x, int16_t y, uint16_t color,
+                             uint16_t bg) {
+  int16_t w = asset.width, h = asset.height;
+  int8_t fg3 = splash3BitColor(color), bg3 = splash3BitColor(bg);
+  if (&tft == &display && dmaPushBuf[0] && fg3 >= 0 && bg3 >= 0 && !(w & 1)) {
+    Splash3BitSource src;
+    src.runs.begin(asset);
+    for (uint8_t p = 0; p < 4; p++) src.pairs[p] = (uint8_t)((((p & 2) ? fg3 : bg3) << 3) | ((p & 1) ? fg3 : bg3));
+    dmaPushFlush();
+    tft.writecommand(ILI9488_COLMOD);
+    tft.writedata(COLMOD_3BIT);
+    pushWindowBytesDMA(x, y, w, h, w / 2, dmaFillFromRuns3Bit, &src);
+    dmaPushFlush();
+    tft.writecommand(ILI9488_COLMOD);
+    tft.writedata(COLMOD_18BIT);
+    return;
+  }
+  if (&tft == &display && dmaPushBuf[0]) {
+    SplashRgb666Source src;
+    src.runs.begin(asset);
+    rgb565ToRgb666Pixel((uint16_t)((bg >> 8) | (bg << 8)), src.colors[0]);
+    rgb565ToRgb666Pixel((uint16_t)((color >> 8) | (color << 8)), src.colors[1]);
+    pushWindowDMA(x, y, w, h, dmaFillFromRuns, &src);
+    dmaPushFlush();  // callers draw on top straight away
+    return;
+  }
+
+  if (w > SPLASH_BLIT_MAX_W) return;
+  uint16_t line[SPLASH_BLIT_MAX_W];
+  bool swap = tft.getSwapBytes();
+  tft.setSwapBytes(false);
+  uint16_t wire[2] = { (uint16_t)((bg >> 8) | (bg << 8)), (uint16_t)((color >> 8) | (color << 8)) };  // pushImage() sends as stored
+  SplashRunReader runs;
+  runs.begin(asset);
+  for (int16_t j = 0; j < h; j++) {
+    for (int16_t i = 0; i < w; i++) line[i] = wire[runs.pixel()];
+    tft.pushImage(x, y + j, w, 1, line);
+  }
+  tft.setSwapBytes(swap);
+}
+
+/**
+ * @brief Draw a splash image, clearing only the part of the screen it leaves uncovered
+ */
+inline void splashDraw(TFT_eSPI& tft, const SplashAsset& asset, int16_t x, int16_t y, uint16_t color, uint16_t bg) {
+  if (x > 0 || y > 0 || x + asset.width < tft.width() || y + asset.height < tft.height()) tft.fillScreen(bg);
+  splashBlitPacked(tft, asset, x, y, color, bg);
+}
+
+#endif  // SPLASH_BLIT_H
@@ -0,0 +1,142 @@
+/**
+ * @file splash_file.h
+ * @brief Custom colour splash image on LittleFS
+ *
+ * One user image, /splash.jpg or /splash.bmp, uploaded through the web page
+ * or put in data/ before `pio run -t uploadfs`. JPEGs go through TJpg_Decoder,
+ * which works one MCU block (16x16 for 4:2:0) at a time in a 3 KB work area;
+ * each block is converted into the DMA push buffers and sent while the next
+ * one decodes. BMPs use the streaming decoder in splash_image.h. Neither
+ * holds more than a block or a line of the image.
+ *
+ * Images bigger than the screen are only accepted as JPEGs, which are shown
+ * at 1/2, 1/4 or 1/8 scale to fit; they still decode every pixel, so an
+ * image sized to 480x320 draws fastest. Device only: the host build has no
+ * filesystem and stubs these out in splash_manager.h.
+ */
+
+#ifndef SPLASH_FILE_H
+#define SPLASH_FILE_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <TFT_eSPI.h>
+#include <TJpg_Decoder.h>
+#include "../dma_push.h"
+#include "splash_image.h"
+
+#define SPLASH_FILE_JPG "/splash.jpg"
+#define SPLASH_FILE_BMP "/splash.bmp"
+#define SPLASH_FILE_UPLOAD "/splash.tmp"  // an upload lands here until it has been checked
+
+static bool splashFsReady() {
+  static bool mounted = LittleFS.begin();
+  return mounted;
+}
+
+bool splashFileExists() {
+  return splashFsReady() && (LittleFS.exists(SPLASH_FILE_JPG) || LittleFS.exists(SPLASH_FILE_BMP));
+}
+
+static uint32_t splashFileRead(uint8_t* dst, uint32_t len, void* ctx) {
+  return ((File*)ctx)->read(dst, len);
+}
+
+struct SplashJpgBlock {
+  const uint16_t* pixels;  // byte-swapped RGB565, `width` per row
+};
+
+static void dmaFillFromJpgBlock(uint8_t* dst, int16_t line, int16_t lines, int16_t width, void* ctx) {
+  const uint16_t* pixels = ((SplashJpgBlock*)ctx)->pixels + line * width;
+  rgb565ToRgb666Run(pixels, dst, (int32_t)lines * width);
+}
+
+static bool splashJpgOutput(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t* bitmap) {
+  if (x < 0 || y < 0 || x + w > display.width() || y + h > display.height()) return true;  // never off screen
+  SplashJpgBlock block = { bitmap };
+  pushWindowDMA(x, y, w, h, dmaFillFromJpgBlock, &block);  // copied out before the decoder reuses the block
+  return true;
+}
+
+// Smallest TJpg_Decoder scale (1, 2, 4 or 8) that fits the screen, or 0 if none does
+static uint8_t splashJpgScale(TFT_eSPI& tft, uint16_t w, uint16_t h) {
+  for (uint8_t scale = 1; scale <= 8; scale *= 2) {
+    if (w / scale <= tft.width() && h / scale <= tft.height()) return scale;
+  }
+  return 0;
+}
+
+static bool splashDrawJpg(TFT_eSPI& tft, const char* path, uint16_t bg) {
+  uint16_t w, h;
+  if (TJpgDec.getFsJpgSize(&w, &h, path, LittleFS) != JDR_OK) return false;
+  uint8_t scale = splashJpgScale(tft, w, h);
+  if (!scale) return false;
+  w /= scale;
+  h /= scale;
+  int32_t x = (tft.width() - w) / 2, y = (tft.height() - h) / 2;
+  if (x > 0 || y > 0) tft.fillScreen(bg);
+  TJpgDec.setJpgScale(scale);
+  TJpgDec.setSwapBytes(true);  // blocks come out as the DMA converter reads sprites
+  TJpgDec.setCallback(splashJpgOutput);
+  bool ok = TJpgDec.drawFsJpg(x, y, path, LittleFS) == JDR_OK;
+  dmaPushFlush();
+  return ok;
+}
+
+static bool splashDrawBmpFile(TFT_eSPI& tft, const char* path, uint16_t bg) {
+  File file = LittleFS.open(path, "r");
+  if (!file) return false;
+  bool ok = splashDrawBmp(tft, splashFileRead, &file, bg);
+  file.close();
+  return ok;
+}
+
+/**
+ * @brief Draw the custom splash image
+ * @return false if there is none or it can't be decoded; the caller draws a built-in logo instead
+ */
+bool splashFileDraw(TFT_eSPI& tft, uint16_t bg) {
+  if (&tft != &display || !dmaPushBuf[0] || !splashFsReady()) return false;
+  if (LittleFS.exists(SPLASH_FILE_JPG)) return splashDrawJpg(tft, SPLASH_FILE_JPG, bg);
+  if (LittleFS.exists(SPLASH_FILE_BMP)) return splashDrawBmpFile(tft, SPLASH_FILE_BMP, bg);
+  return false;
+}
+
+/**
+ * @brief Check an uploaded file and make it the custom splash image
+ * @param path Where the upload was written; removed either way
+ * @return false if it isn't a baseline JPEG or an 8/24-bit BMP the screen can show
+ */
+bool splashFileInstall(const char* path) {
+  if (!splashFsReady()) return false;
+  File file = LittleFS.open(path, "r");
+  uint8_t header[BMP_HEADER_BYTES];
+  size_t len = file ? file.read(header, sizeof(header)) : 0;
+  file.close();
+
+  const char* target = nullptr;
+  BmpInfo bmp;
+  uint16_t w, h;
+  if (len >= 2 && header[0] == 0xFF && header[1] == 0xD8) {
+    // getFsJpgSize() parses up to the first scan, so progressive files fail here
+    if (TJpgDec.getFsJpgSize(&w, &h, path, LittleFS) == JDR_OK && splashJpgScale(display, w, h)) target = SPLASH_FILE_JPG;
+  } else if (len == sizeof(header) && bmpParseHeader(header, bmp) && bmp.width <= display.width() &&
+             bmp.height <= display.height()) {
+    target = SPLASH_FILE_BMP;
+  }
+  if (!target) {
+    LittleFS.remove(path);
+    return false;
+  }
+  LittleFS.remove(SPLASH_FILE_JPG);
+  LittleFS.remove(SPLASH_FILE_BMP);
+  return LittleFS.rename(path, target);
+}
+
+void splashFileRemove() {
+  if (!splashFsReady()) return;
+  LittleFS.remove(SPLASH_FILE_JPG);
+  LittleFS.remove(SPLASH_FILE_BMP);
+}
+
+#endif  // SPLASH_FILE_H
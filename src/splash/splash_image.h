@@ -0,0 +1,155 @@
+/**
+ * @file splash_image.h
+ * @brief Streaming BMP decode for colour splash images
+ *
+ * A full-screen colour image doesn't fit in RAM, so it is never held there:
+ * rows are read from the source straight into the DMA push buffers and
+ * expanded in place, each chunk decoded while the previous one is on the
+ * wire. 24-bit rows only need their blue and red swapped to be RGB666; 8-bit
+ * rows are read into the back of the line and expanded forwards through the
+ * palette. Peak RAM is the 768-byte palette. Bottom-up files, the usual
+ * kind, go out one row per window from the bottom of the image.
+ *
+ * The source is any sequential reader, so the same decoder runs on a
+ * LittleFS file on the device (splash_file.h) and on a plain file on the host.
+ */
+
+#ifndef SPLASH_IMAGE_H
+#define SPLASH_IMAGE_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "../dma_push.h"
+
+#define BMP_HEADER_BYTES 54  // file header and BITMAPINFOHEADER
+#define BMP_MAX_W 480
+#define BMP_MAX_H 320
+
+// Fill up to `len` bytes of `dst` from the source; returns how many were read
+typedef uint32_t (*SplashRead)(uint8_t* dst, uint32_t len, void* ctx);
+
+struct BmpInfo {
+  int32_t width, height;  // height as drawn, always positive
+  bool topDown;
+  uint8_t bpp;            // 8 or 24
+  uint16_t colors;        // palette entries, 8-bit only
+  uint32_t paletteOffset;
+  uint32_t dataOffset;
+};
+
+static inline uint32_t bmpU32(const uint8_t* p) {
+  return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Check the first BMP_HEADER_BYTES of a file. Only uncompressed 8- and 24-bit
+// images that fit the screen are accepted.
+static inline bool bmpParseHeader(const uint8_t* h, BmpInfo& info) {
+  if (h[0] != 'B' || h[1] != 'M') return false;
+  uint32_t dibSize = bmpU32(h + 14);
+  int32_t width = (int32_t)bmpU32(h + 18), height = (int32_t)bmpU32(h + 22);
+  uint16_t planes = h[26] | (h[27] << 8), bpp = h[28] | (h[29] << 8);
+  uint32_t compression = bmpU32(h + 30), used = bmpU32(h + 46);
+  if (dibSize < 40 || planes != 1 || compression != 0 || (bpp != 8 && bpp != 24)) return false;
+  info.topDown = height < 0;
+  info.width = width;
+  info.height = info.topDown ? -height : height;
+  if (width < 1 || width > BMP_MAX_W || info.height < 1 || info.height > BMP_MAX_H) return false;
+  info.bpp = (uint8_t)bpp;
+  info.colors = (bpp == 8) ? (used ? used : 256) : 0;
+  info.paletteOffset = 14 + dibSize;
+  info.dataOffset = bmpU32(h + 10);
+  return used <= 256 && info.dataOffset >= info.paletteOffset + info.colors * 4;
+}
+
+struct BmpSource {
+  SplashRead read;
+  void* ctx;
+  const BmpInfo* info;
+  uint8_t palette[256][3];  // RGB666
+  bool ok;                  // false once the source has come up short
+};
+
+static bool bmpRead(BmpSource* src, uint8_t* dst, uint32_t len) {
+  while (len && src->ok) {
+    uint32_t n = src->read(dst, len, src->ctx);
+    if (!n) src->ok = false;
+    dst += n;
+    len -= n;
+  }
+  return src->ok;
+}
+
+static bool bmpSkip(BmpSource* src, uint32_t len) {
+  uint8_t scratch[32];
+  while (len && src->ok) {
+    uint32_t n = (len < sizeof(scratch)) ? len : sizeof(scratch);
+    bmpRead(src, scratch, n);
+    len -= n;
+  }
+  return src->ok;
+}
+
+static void dmaFillFromBmp(uint8_t* dst, int16_t line, int16_t lines, int16_t width, void* ctx) {
+  (void)line;
+  BmpSource* src = (BmpSource*)ctx;
+  uint32_t rowBytes = (uint32_t)width * src->info->bpp / 8;
+  uint32_t pad = (4 - (rowBytes & 3)) & 3;
+  for (int16_t l = 0; l < lines; l++, dst += width * 3) {
+    if (src->info->bpp == 24) {
+      if (bmpRead(src, dst, rowBytes)) {
+        for (int16_t i = 0; i < width; i++) {
+          uint8_t b = dst[i * 3];
+          dst[i * 3] = dst[i * 3 + 2];
+          dst[i * 3 + 2] = b;
+        }
+      }
+    } else {
+      uint8_t* index = dst + width * 2;  // expanding from the front never overtakes the next index
+      if (bmpRead(src, index, rowBytes)) {
+        for (int16_t i = 0; i < width; i++) memcpy(dst + i * 3, src->palette[index[i]], 3);
+      }
+    }
+    bmpSkip(src, pad);
+    if (!src->ok) memset(dst, 0, width * 3);  // the window still has to be filled
+  }
+}
+
+/**
+ * @brief Draw a BMP centred on the screen, clearing what it leaves uncovered to `bg`
+ * @return false if the image isn't a supported BMP, the source came up short,
+ *         or the DMA buffers aren't available
+ */
+inline bool splashDrawBmp(TFT_eSPI& tft, SplashRead read, void* ctx, uint16_t bg) {
+  if (&tft != &display || !dmaPushBuf[0]) return false;
+  BmpInfo info;
+  BmpSource src;
+  src.read = read;
+  src.ctx = ctx;
+  src.info = &info;
+  src.ok = true;
+  uint8_t header[BMP_HEADER_BYTES];
+  if (!bmpRead(&src, header, sizeof(header)) || !bmpParseHeader(header, info)) return false;
+  if (info.width > tft.width() || info.height > tft.height()) return false;
+  bmpSkip(&src, info.paletteOffset - BMP_HEADER_BYTES);
+  for (uint16_t c = 0; c < info.colors && src.ok; c++) {
+    uint8_t bgrx[4];
+    bmpRead(&src, bgrx, 4);
+    src.palette[c][0] = bgrx[2];
+    src.palette[c][1] = bgrx[1];
+    src.palette[c][2] = bgrx[0];
+  }
+  if (info.colors < 256) memset(src.palette[info.colors], 0, (256 - info.colors) * 3);  // stray indices draw black
+  if (!bmpSkip(&src, info.dataOffset - info.paletteOffset - info.colors * 4)) return false;
+
+  int32_t x = (tft.width() - info.width) / 2, y = (tft.height() - info.height) / 2;
+  if (x > 0 || y > 0) tft.fillScreen(bg);
+  if (info.topDown) {
+    pushWindowDMA(x, y, info.width, info.height, dmaFillFromBmp, &src);
+  } else {
+    for (int32_t r = info.height - 1; r >= 0; r--) pushWindowDMA(x, y + r, info.width, 1, dmaFillFromBmp, &src);
+  }
+  dmaPushFlush();
+  return src.ok;
+}
+
+#endif  // SPLASH_IMAGE_H
@@ -26,9 +26,17 @@
 #define EEPROM_SIZE 512
 #endif
 
-#include "zettech.h"
-#include "mazduino.h"
-#include "speeduino.h"
+#include "splash_assets.h"
+#include "splash_blit.h"
+#ifndef HOST_DISPLAY
+#include "splash_file.h"
+#else
+// The host build has no filesystem, so there is never a custom image
+inline bool splashFileExists() { return false; }
+inline bool splashFileDraw(TFT_eSPI&, uint16_t) { return false; }
+#endif
+
+#define SPLASH_DISPLAY_TIME 3000  // milliseconds
 
 // EEPROM addresses for splash screen settings
 #define SPLASH_SELECTION_ADDR 1  // EEPROM address for splash selection (address 0 is used by main code)
@@ -38,41 +46,22 @@ enum SplashType {
     SPLASH_ZETTECH = 0,
     SPLASH_MAZDUINO = 1,
     SPLASH_SPEEDUINO = 2,
-    SPLASH_COUNT = 3  // Total number of splash screens
+    SPLASH_CUSTOM = 3,  // Colour image on LittleFS; the ones before it are packed logos
+    SPLASH_COUNT = 4  // Total number of splash screens
 };
 
 // Forward declaration
 bool setSplashScreen(SplashType splashType);
 
-// Splash screen information structure
-struct SplashInfo {
-    const char* name;
-    const unsigned char* bitmap;
-    void (*drawFunction)(TFT_eSPI&, int16_t, int16_t, uint16_t, uint16_t);
-    void (*showFunction)(TFT_eSPI&, uint16_t);
-};
+static_assert(SPLASH_PACK_COUNT == SPLASH_CUSTOM, "splash_assets.h doesn't match SplashType");
 
-// Splash screen registry
-const SplashInfo splashScreens[SPLASH_COUNT] = {
-    {
-        "ZetTech ECU",
-        epd_bitmap_ztech,
-        drawZetTechSplash,
-        showZetTechSplash
-    },
-    {
-        "Mazduino ECU", 
-        epd_bitmap_mazduino_logo,
-        drawMazduinoSplash,
-        showMazduinoSplash
-    },
-    {
-        "Speeduino ECU",
-        epd_bitmap_speeduino,
-        drawSpeeduinoSplash,
-        showSpeeduinoSplash
-    }
-};
+/**
+ * @brief Look up a splash image in the pack
+ * @return false if the pack doesn't hold it
+ */
+bool getSplashAsset(SplashType splashType, SplashAsset& asset) {
+    return splashPackEntry(splashPack, sizeof(splashPack), splashType, asset);
+}
 
 /**
  * @brief Initialize splash screen manager
@@ -123,6 +112,9 @@ bool setSplashScreen(SplashType splashType) {
 SplashType nextSplashScreen() {
     SplashType current = getCurrentSplashScreen();
     SplashType next = (SplashType)((current + 1) % SPLASH_COUNT);
+    if (next == SPLASH_CUSTOM && !splashFileExists()) {
+        next = (SplashType)((next + 1) % SPLASH_COUNT);  // Nothing uploaded yet
+    }
     setSplashScreen(next);
     return next;
 }
@@ -133,60 +125,68 @@ SplashType nextSplashScreen() {
  * @return Name of the splash screen
  */
 const char* getSplashScreenName(SplashType splashType = getCurrentSplashScreen()) {
-    if (splashType >= SPLASH_COUNT) {
+    if (splashType == SPLASH_CUSTOM) {
+        return "Custom image";
+    }
+    SplashAsset asset;
+    if (!getSplashAsset(splashType, asset)) {
         return "Unknown";
     }
-    return splashScreens[splashType].name;
+    return asset.name;
 }
 
 /**
- * @brief Draw current splash screen
+ * @brief Draw specific splash screen
  * @param tft TFT display object
+ * @param splashType Specific splash screen type
  * @param x X position (default: 0)
  * @param y Y position (default: 0)
  * @param color_fg Foreground color (default: TFT_WHITE)
  * @param color_bg Background color (default: TFT_BLACK)
  */
-void drawCurrentSplash(TFT_eSPI& tft, int16_t x = 0, int16_t y = 0, 
-                       uint16_t color_fg = TFT_WHITE, uint16_t color_bg = TFT_BLACK) {
-    SplashType current = getCurrentSplashScreen();
-    splashScreens[current].drawFunction(tft, x, y, color_fg, color_bg);
+void drawSplash(TFT_eSPI& tft, SplashType splashType, int16_t x = 0, int16_t y = 0,
+                uint16_t color_fg = TFT_WHITE, uint16_t color_bg = TFT_BLACK) {
+    if (splashType == SPLASH_CUSTOM) {
+        if (splashFileDraw(tft, color_bg)) return;
+        splashType = SPLASH_ZETTECH;  // Missing or unreadable: fall back to a built-in logo
+    }
+    SplashAsset asset;
+    if (!getSplashAsset(splashType, asset)) return;
+    // One windowed push; the screen is only cleared where the image doesn't reach
+    splashDraw(tft, asset, x, y, color_fg, color_bg);
 }
 
 /**
- * @brief Show current splash screen with delay
+ * @brief Show specific splash screen with delay
  * @param tft TFT display object
- * @param delay_ms Display duration in milliseconds (default: 3000)
+ * @param splashType Specific splash screen type
+ * @param delay_ms Display duration in milliseconds
  */
-void showCurrentSplash(TFT_eSPI& tft, uint16_t delay_ms = SPLASH_DISPLAY_TIME) {
-    SplashType current = getCurrentSplashScreen();
-    splashScreens[current].showFunction(tft, delay_ms);
+void showSplash(TFT_eSPI& tft, SplashType splashType, uint16_t delay_ms = SPLASH_DISPLAY_TIME) {
+    drawSplash(tft, splashType);
+    delay(delay_ms);
 }
 
 /**
- * @brief Draw specific splash screen
+ * @brief Draw current splash screen
  * @param tft TFT display object
- * @param splashType Specific splash screen type
  * @param x X position (default: 0)
  * @param y Y position (default: 0)
  * @param color_fg Foreground color (default: TFT_WHITE)
  * @param color_bg Background color (default: TFT_BLACK)
  */
-void drawSplash(TFT_eSPI& tft, SplashType splashType, int16_t x = 0, int16_t y = 0,
-                uint16_t color_fg = TFT_WHITE, uint16_t color_bg = TFT_BLACK) {
-    if (splashType >= SPLASH_COUNT) return;
-    splashScreens[splashType].drawFunction(tft, x, y, color_fg, color_bg);
+void drawCurrentSplash(TFT_eSPI& tft, int16_t x = 0, int16_t y = 0, 
+                       uint16_t color_fg = TFT_WHITE, uint16_t color_bg = TFT_BLACK) {
+    drawSplash(tft, getCurrentSplashScreen(), x, y, color_fg, color_bg);
 }
 
 /**
- * @brief Show specific splash screen with delay
+ * @brief Show current splash screen with delay
  * @param tft TFT display object
- * @param splashType Specific splash screen type
- * @param delay_ms Display duration in milliseconds
+ * @param delay_ms Display duration in milliseconds (default: 3000)
  */
-void showSplash(TFT_eSPI& tft, SplashType splashType, uint16_t delay_ms = SPLASH_DISPLAY_TIME) {
-    if (splashType >= SPLASH_COUNT) return;
-    splashScreens[splashType].showFunction(tft, delay_ms);
+void showCurrentSplash(TFT_eSPI& tft, uint16_t delay_ms = SPLASH_DISPLAY_TIME) {
+    showSplash(tft, getCurrentSplashScreen(), delay_ms);
 }
 
 /**
@@ -197,7 +197,7 @@ void listSplashScreens() {
     for (int i = 0; i < SPLASH_COUNT; i++) {
         Serial.print(i);
         Serial.print(": ");
-        Serial.println(splashScreens[i].name);
+        Serial.println(getSplashScreenName((SplashType)i));
     }
     Serial.print("Current: ");
     Serial.println(getSplashScreenName());
@@ -0,0 +1,94 @@
+#ifndef SPLASH_PACK_H
+#define SPLASH_PACK_H
+
+// Splash asset pack: the 1-bit logos, run-length coded.
+//
+// The logos are mostly long stretches of black, so each is stored as its
+// pixels in raster order split into alternating runs, clear first. A run
+// length is one byte below 0x80, or two bytes big-endian with the top bit
+// set; longer runs are split by an empty run of the other colour. A pack
+// starts with "SPK1" and an image count, then one entry per image:
+//
+//   name[16] width:u16 height:u16 offset:u32 length:u32
+//
+// (little-endian; offset from the start of the pack). tools/splash_pack.py
+// builds one from PBM or other images, and checks each stream decodes back.
+// The pack is compiled into flash, so nothing is checked again at run time.
+// SplashRunReader hands out runs on demand, so the decoder writes straight
+// into the push line buffers and never holds a whole bitmap.
+
+#include <stdint.h>
+#include <string.h>
+
+#define SPLASH_PACK_HEADER_BYTES 8
+#define SPLASH_PACK_ENTRY_BYTES 28
+#define SPLASH_NAME_LEN 16
+
+struct SplashAsset {
+  const char* name;  // in the pack
+  uint16_t width, height;
+  const uint8_t* stream;
+  uint32_t length;
+};
+
+static inline uint32_t splashPackU32(const uint8_t* p) {
+  return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint8_t splashPackCount(const uint8_t* pack, uint32_t size) {
+  if (size < SPLASH_PACK_HEADER_BYTES || memcmp(pack, "SPK1", 4) != 0) return 0;
+  uint8_t count = pack[4];
+  return (SPLASH_PACK_HEADER_BYTES + (uint32_t)count * SPLASH_PACK_ENTRY_BYTES <= size) ? count : 0;
+}
+
+// Look up image `index`. False if the pack is malformed or too short for it.
+static inline bool splashPackEntry(const uint8_t* pack, uint32_t size, uint8_t index, SplashAsset& out) {
+  if (index >= splashPackCount(pack, size)) return false;
+  const uint8_t* e = pack + SPLASH_PACK_HEADER_BYTES + index * SPLASH_PACK_ENTRY_BYTES;
+  uint32_t offset = splashPackU32(e + 20), length = splashPackU32(e + 24);
+  if (offset > size || length > size - offset || e[SPLASH_NAME_LEN - 1] != '\0') return false;
+  out.name = (const char*)e;
+  out.width = e[16] | (e[17] << 8);
+  out.height = e[18] | (e[19] << 8);
+  out.stream = pack + offset;
+  out.length = length;
+  return true;
+}
+
+// Streaming run decoder; take() calls continue where the previous one stopped.
+// A stream that ends early reads as clear pixels from there on.
+struct SplashRunReader {
+  const uint8_t* next;
+  const uint8_t* end;
+  uint32_t left;  // pixels left in the current run
+  uint8_t color;  // 0 = clear, 1 = set
+
+  void begin(const SplashAsset& asset) {
+    next = asset.stream;
+    end = asset.stream + asset.length;
+    left = 0;
+    color = 1;  // the first run read is clear
+  }
+
+  // Make sure the current run has at least one pixel left
+  void fill() {
+    while (!left) {
+      if (next >= end) {
+        color = 0;
+        left = UINT32_MAX;
+        return;
+      }
+      color ^= 1;
+      left = *next++;
+      if ((left & 0x80) && next < end) left = ((left & 0x7F) << 8) | *next++;
+    }
+  }
+
+  uint8_t pixel() {
+    fill();
+    left--;
+    return color;
+  }
+};
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef STARTUP_SWEEP_H
+#define STARTUP_SWEEP_H
+
+// Timing for the RPM sweep that opens the gauge page.
+//
+// The sweep used to step the bar down 250 RPM per frame, so how long it
+// took depended on the SPI clock and it held up everything after it. Now the
+// value is a function of time: it runs from full scale to 0 over
+// SWEEP_DURATION_MS, one frame every SWEEP_FRAME_MS, and a late frame is
+// dropped rather than slowing the sweep down. The caller draws a frame when
+// sweepFrameDue() says so and has the gaps in between to itself (see
+// setup(), which polls the ECU there).
+
+#include <stdint.h>
+
+#define SWEEP_DURATION_MS 600
+#define SWEEP_FRAME_MS 33  // 30 fps
+
+struct StartupSweep {
+  uint32_t startMs;
+  uint32_t nextFrameMs;
+  int32_t from;     // RPM at the start
+  uint16_t frames;  // drawn so far
+  bool done;        // the final 0 RPM frame is out
+};
+
+static inline void sweepBegin(StartupSweep& sweep, int32_t from, uint32_t now) {
+  sweep.startMs = now;
+  sweep.nextFrameMs = now;
+  sweep.from = from;
+  sweep.frames = 0;
+  sweep.done = false;
+}
+
+// RPM the sweep shows at `now`
+static inline int32_t sweepRpmAt(const StartupSweep& sweep, uint32_t now) {
+  uint32_t elapsed = now - sweep.startMs;
+  if (elapsed >= SWEEP_DURATION_MS) return 0;
+  return sweep.from - (int32_t)((int64_t)sweep.from * elapsed / SWEEP_DURATION_MS);
+}
+
+static inline bool sweepFrameDue(const StartupSweep& sweep, uint32_t now) {
+  return !sweep.done && (int32_t)(now - sweep.nextFrameMs) >= 0;
+}
+
+// Book a frame drawn at `now`, which showed sweepRpmAt(now)
+static inline void sweepFrameDrawn(StartupSweep& sweep, uint32_t now) {
+  sweep.frames++;
+  sweep.done = now - sweep.startMs >= SWEEP_DURATION_MS;
+  sweep.nextFrameMs += SWEEP_FRAME_MS;
+  if ((int32_t)(now - sweep.nextFrameMs) >= 0) {
+    sweep.nextFrameMs = now + SWEEP_FRAME_MS;  // fell behind: drop the missed frames
+  }
+  uint32_t end = sweep.startMs + SWEEP_DURATION_MS;
+  if ((int32_t)(sweep.nextFrameMs - end) > 0) sweep.nextFrameMs = end;  // always land on 0 on time
+}
+
+// Time until the next frame is due; 0 if it already is, or the sweep is over
+static inline uint32_t sweepSpareMs(const StartupSweep& sweep, uint32_t now) {
+  return (sweep.done || sweepFrameDue(sweep, now)) ? 0 : sweep.nextFrameMs - now;
+}
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef STATUS_ROW_H
+#define STATUS_ROW_H
+
+// The SYNC/FAN/ASE/WUE/REV/LCH/AC/DFCO button row.
+//
+// The eight flags arrive packed into one byte (bit 0 = SYNC ... bit 7 = DFCO)
+// and only buttons whose bit differs from what is on screen are pushed. Each
+// button - outline and anti-aliased label - is rendered once into a 4-bit
+// sprite with the same coverage-ramp trick as the gauges, so the off (white)
+// and on (green, or red for REV/LCH) states are just two palettes over the
+// same pixels and a state change is a single 50x30 push.
+
+#include "gauge_sprite.h"
+#include "render_profiler.h"
+
+#define STATUS_BUTTON_COUNT 8
+#define STATUS_BUTTON_W 50
+#define STATUS_BUTTON_H 30
+#define STATUS_ROW_X 10
+#define STATUS_ROW_Y 285
+#define STATUS_ROW_PITCH 60
+
+#define STATUS_ALARM_MASK 0x30  // REV and LCH light up red instead of green
+
+const char* const statusLabels[STATUS_BUTTON_COUNT] = { "SYNC", "FAN", "ASE", "WUE", "REV", "LCH", "AC", "DFCO" };
+
+enum StatusPalette { STATUS_OFF, STATUS_ON, STATUS_ALARM, STATUS_PALETTES };
+const uint16_t statusColors[STATUS_PALETTES] = { TFT_WHITE, TFT_GREEN, TFT_RED };
+
+struct StatusRow {
+  TFT_eSprite* buttons[STATUS_BUTTON_COUNT];
+  uint8_t palette666[STATUS_PALETTES][16 * 3];
+  uint8_t shown;  // flags currently on screen
+  bool valid;     // false until the whole row has been drawn once
+};
+
+StatusRow statusRow;
+
+// Render the label cache. Done once; the font is only needed while rendering.
+void statusRowBegin() {
+  if (statusRow.buttons[0]) return;
+  for (uint8_t p = 0; p < STATUS_PALETTES; p++) gaugeRampToRgb666(statusColors[p], TFT_BLACK, statusRow.palette666[p]);
+
+  for (uint8_t i = 0; i < STATUS_BUTTON_COUNT; i++) {
+    TFT_eSprite* s = new TFT_eSprite(&display);
+    s->setColorDepth(4);
+    s->createSprite(STATUS_BUTTON_W, STATUS_BUTTON_H);
+    s->fillSprite(0);
+    s->drawRoundRect(0, 0, STATUS_BUTTON_W, STATUS_BUTTON_H, 5, GAUGE_INK);
+    s->loadFont(AA_FONT_SMALL);
+    s->setTextDatum(MC_DATUM);
+    s->setTextColor(GAUGE_INK, 0);
+    s->drawString(statusLabels[i], STATUS_BUTTON_W / 2, STATUS_BUTTON_H / 2);
+    s->unloadFont();
+    statusRow.buttons[i] = s;
+  }
+  statusRow.valid = false;
+}
+
+// `blank`: the screen under the button is known to be black, so only its ink is sent
+void statusButtonPush(uint8_t index, bool on, bool blank = false) {
+  RENDER_PROFILE(PROF_BUTTON);
+  TFT_eSprite& s = *statusRow.buttons[index];
+  StatusPalette p = !on ? STATUS_OFF : ((STATUS_ALARM_MASK >> index) & 1) ? STATUS_ALARM : STATUS_ON;
+  int32_t x = STATUS_ROW_X + STATUS_ROW_PITCH * index;
+
+  if (!dmaPushBuf[0]) {
+    for (uint8_t i = 0; i < 16; i++) s.setPaletteColor(i, gaugeRampColor(i, statusColors[p], TFT_BLACK));
+    s.pushSprite(x, STATUS_ROW_Y);
+    return;
+  }
+  if (blank) {
+    gaugePushInk((const uint8_t*)s.getPointer(), STATUS_BUTTON_W, STATUS_BUTTON_H, x, STATUS_ROW_Y, statusRow.palette666[p]);
+    return;
+  }
+  GaugePushSource src = { (const uint8_t*)s.getPointer(), STATUS_BUTTON_W / 2, statusRow.palette666[p], 0 };
+  pushWindowDMA(x, STATUS_ROW_Y, STATUS_BUTTON_W, STATUS_BUTTON_H, dmaFillFromGauge, &src);
+}
+
+// Push the buttons whose flag changed since the last call; `force` redraws all. The
+// first draw and the one after statusRowErase() land on black and only send ink.
+void statusRowDraw(uint8_t flags, bool force = false) {
+  statusRowBegin();
+  bool blank = !statusRow.valid;
+  uint8_t changed = (force || blank) ? 0xFF : (uint8_t)(flags ^ statusRow.shown);
+  for (uint8_t i = 0; i < STATUS_BUTTON_COUNT; i++) {
+    if (changed & (1 << i)) statusButtonPush(i, flags & (1 << i), blank);
+  }
+  statusRow.shown = flags;
+  statusRow.valid = true;
+}
+
+// Remove the row from the screen; the next statusRowDraw() repaints every button
+void statusRowErase() {
+  if (!statusRow.valid) return;
+  for (uint8_t i = 0; i < STATUS_BUTTON_COUNT; i++) {
+    gaugeEraseInk((const uint8_t*)statusRow.buttons[i]->getPointer(), STATUS_BUTTON_W, STATUS_BUTTON_H, 0,
+                  STATUS_ROW_X + STATUS_ROW_PITCH * i, STATUS_ROW_Y, TFT_BLACK);
+  }
+  statusRow.valid = false;
+}
+
+#endif
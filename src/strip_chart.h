@@ -0,0 +1,168 @@
+#ifndef STRIP_CHART_H
+#define STRIP_CHART_H
+
+// Scrolling strip chart over a per-channel sample history.
+//
+// History lives in a fixed ring per channel (ChartRing) that is fed whether
+// or not a chart is on screen. A chart keeps a 4-bit sprite as a circular
+// buffer of columns: a new sample only renders its own column (background,
+// grid dots and the trace segment from the previous sample), which is
+// O(height) however wide the chart is. The sprite is then pushed in two
+// pieces - oldest columns first, then the columns up to the newest - so the
+// wraparound never needs pixels to be moved.
+
+#include <TFT_eSPI.h>
+#include "gauge_sprite.h"
+#include "dma_push.h"
+
+struct ChartRing {
+  int16_t* samples;
+  uint16_t capacity;
+  uint16_t count;  // valid samples, up to capacity
+  uint16_t head;   // slot the next sample goes into
+  uint32_t total;  // samples ever pushed, so charts can tell what they missed
+};
+
+bool chartRingBegin(ChartRing& ring, uint16_t capacity) {
+  ring.samples = (int16_t*)calloc(capacity, sizeof(int16_t));
+  ring.capacity = ring.samples ? capacity : 0;
+  ring.count = ring.head = 0;
+  ring.total = 0;
+  return ring.samples != nullptr;
+}
+
+void chartRingPush(ChartRing& ring, int16_t value) {
+  if (!ring.capacity) return;
+  ring.samples[ring.head] = value;
+  ring.head = (ring.head + 1) % ring.capacity;
+  if (ring.count < ring.capacity) ring.count++;
+  ring.total++;
+}
+
+// Sample `age` steps back, 0 = newest. `age` must be below count.
+int16_t chartRingAt(const ChartRing& ring, uint16_t age) {
+  return ring.samples[(ring.head + ring.capacity - 1 - age) % ring.capacity];
+}
+
+enum ChartColor { CHART_BG, CHART_GRID, CHART_TRACE, CHART_COLORS };
+
+struct StripChart {
+  const ChartRing* ring;
+  int16_t x, y, w, h;  // w must be even
+  int16_t minValue, maxValue, gridStep;
+  TFT_eSprite* sprite;
+  uint8_t palette666[16 * 3];
+  int16_t column;      // sprite column holding the newest sample
+  uint32_t drawn;      // ring.total at the last update
+  int16_t lastY;       // trace row of the newest sample
+};
+
+static int16_t stripChartRow(const StripChart& chart, int16_t value) {
+  int32_t v = constrain(value, chart.minValue, chart.maxValue);
+  return (chart.h - 1) - (int32_t)(v - chart.minValue) * (chart.h - 1) / (chart.maxValue - chart.minValue);
+}
+
+static void stripChartGrid(StripChart& chart, int16_t col) {
+  if (chart.gridStep <= 0) return;
+  for (int32_t v = chart.minValue; v <= chart.maxValue; v += chart.gridStep) {
+    chart.sprite->drawPixel(col, stripChartRow(chart, v), CHART_GRID);
+  }
+}
+
+// Render one sample into sprite column `col`, joined to the previous trace row
+static void stripChartColumn(StripChart& chart, int16_t col, int16_t value) {
+  TFT_eSprite& s = *chart.sprite;
+  s.drawFastVLine(col, 0, chart.h, CHART_BG);
+  stripChartGrid(chart, col);
+  int16_t row = stripChartRow(chart, value);
+  int16_t from = (chart.lastY < 0) ? row : chart.lastY;
+  s.drawFastVLine(col, min(row, from), abs(row - from) + 1, CHART_TRACE);
+  chart.lastY = row;
+}
+
+// Oldest column on the left: [column + 1, w) first, then [0, column]
+static void stripChartPush(StripChart& chart) {
+  const uint8_t* pixels = (const uint8_t*)chart.sprite->getPointer();
+  int16_t split = chart.column + 1;
+  if (split < chart.w) {
+    GaugePushSource older = { pixels, chart.w / 2, chart.palette666, split };
+    pushWindowDMA(chart.x, chart.y, chart.w - split, chart.h, dmaFillFromGauge, &older);
+  }
+  GaugePushSource newer = { pixels, chart.w / 2, chart.palette666, 0 };
+  pushWindowDMA(chart.x + chart.w - split, chart.y, split, chart.h, dmaFillFromGauge, &newer);
+}
+
+// Rebuild every column from the ring and push the whole chart
+void stripChartRedraw(StripChart& chart) {
+  chart.sprite->fillSprite(CHART_BG);
+  const ChartRing& ring = *chart.ring;
+  uint16_t shown = min((int32_t)ring.count, (int32_t)chart.w);
+  // Join the first column to the sample that just scrolled off, as scrolling would have
+  chart.lastY = (ring.count > shown) ? stripChartRow(chart, chartRingAt(ring, shown)) : -1;
+  for (int16_t col = 0; col < chart.w - shown; col++) stripChartGrid(chart, col);
+  for (int16_t age = shown - 1; age >= 0; age--) stripChartColumn(chart, chart.w - 1 - age, chartRingAt(ring, age));
+  chart.column = chart.w - 1;
+  chart.drawn = ring.total;
+  if (dmaPushBuf[0]) stripChartPush(chart);
+}
+
+bool stripChartBegin(StripChart& chart, const ChartRing& ring, int16_t x, int16_t y, int16_t w, int16_t h,
+                     int16_t minValue, int16_t maxValue, int16_t gridStep, uint16_t traceColor) {
+  chart.ring = &ring;
+  chart.x = x;
+  chart.y = y;
+  chart.w = w;
+  chart.h = h;
+  chart.minValue = minValue;
+  chart.maxValue = maxValue;
+  chart.gridStep = gridStep;
+  chart.sprite = new TFT_eSprite(&display);
+  chart.sprite->setColorDepth(4);
+  if (!chart.sprite->createSprite(w, h)) {
+    delete chart.sprite;
+    chart.sprite = nullptr;
+    return false;
+  }
+  const uint16_t colors[CHART_COLORS] = { TFT_BLACK, TFT_DARKGREY, traceColor };
+  for (uint8_t i = 0; i < CHART_COLORS; i++) {
+    chart.sprite->setPaletteColor(i, colors[i]);
+    rgb565ToRgb666Pixel((uint16_t)((colors[i] >> 8) | (colors[i] << 8)), chart.palette666 + i * 3);
+  }
+  stripChartRedraw(chart);
+  return true;
+}
+
+void stripChartEnd(StripChart& chart) {
+  if (!chart.sprite) return;
+  chart.sprite->deleteSprite();
+  delete chart.sprite;
+  chart.sprite = nullptr;
+}
+
+// Remove the chart from the screen: only grid dots and trace are painted out
+void stripChartErase(StripChart& chart) {
+  if (!chart.sprite) return;
+  gaugeEraseInk((const uint8_t*)chart.sprite->getPointer(), chart.w, chart.h, (chart.column + 1) % chart.w, chart.x,
+                chart.y, TFT_BLACK);
+}
+
+// Draw the samples that arrived since the last call and scroll. Returns false if there were none.
+bool stripChartUpdate(StripChart& chart) {
+  if (!chart.sprite) return false;
+  const ChartRing& ring = *chart.ring;
+  uint32_t fresh = ring.total - chart.drawn;
+  if (fresh == 0) return false;
+  if (fresh >= (uint32_t)chart.w || fresh > ring.count) {
+    stripChartRedraw(chart);
+    return true;
+  }
+  for (int16_t age = fresh - 1; age >= 0; age--) {
+    chart.column = (chart.column + 1) % chart.w;
+    stripChartColumn(chart, chart.column, chartRingAt(ring, age));
+  }
+  chart.drawn = ring.total;
+  if (dmaPushBuf[0]) stripChartPush(chart);
+  return true;
+}
+
+#endif
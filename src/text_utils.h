@@ -1,49 +1,44 @@
 #ifndef TEXT_UTILS_H
 #define TEXT_UTILS_H
 
-void clearBuffer(char *buf)
-{
-  for (uint8_t i = 0; i < strlen(buf); i++)
-  {
-    buf[i] = '\0';
-  }
-}
+// Number formatting for the gauges.
+//
+// Readings are integers with an implied decimal point (AFR 147 is 14.7), so
+// they are formatted with integer arithmetic only: digits are produced right
+// to left in one pass, the point dropped in after `decimals` of them, and the
+// result copied into place with any padding. No floats, no snprintf and no
+// heap, which matters on a core without an FPU.
+
+#include <stdint.h>
+#include <string.h>
 
-uint8_t formatValue(char *buf, int32_t value, uint8_t decimal)
-{
-  // static char temp[STRING_LENGTH];
-  // clearBuffer(temp);
+// Longest result without padding: sign, 10 digits, point, leading zero, NUL
+#define FORMAT_FIXED_MAX 16
+#define FORMAT_FIXED_MAX_DECIMALS 9
 
-  clearBuffer(buf);
-  snprintf(buf, 22, "%d", value);
-  uint8_t len = strlen(buf);
+// Write `value` / 10^decimals with exactly `decimals` places, right-aligned
+// in `width` characters (0 for no padding): formatFixed(buf, -5, 1) is
+// "-0.5", formatFixed(buf, 147, 1, 6) is "  14.7". `buf` must hold
+// max(width + 1, FORMAT_FIXED_MAX) bytes. Returns the length.
+uint8_t formatFixed(char* buf, int32_t value, uint8_t decimals, uint8_t width = 0) {
+  if (decimals > FORMAT_FIXED_MAX_DECIMALS) decimals = FORMAT_FIXED_MAX_DECIMALS;
+  char digits[FORMAT_FIXED_MAX];
+  char* p = digits + sizeof(digits);
+  uint32_t magnitude = (value < 0) ? 0u - (uint32_t)value : (uint32_t)value;
+  uint8_t count = 0;
+  do {
+    *--p = (char)('0' + magnitude % 10);
+    magnitude /= 10;
+    if (++count == decimals) *--p = '.';
+  } while (magnitude || count <= decimals);  // "0.5", not ".5"
+  if (value < 0) *--p = '-';
 
-  if (decimal != 0)
-  {
-    uint8_t target = decimal + 1;
-    uint8_t numLen = len - ((value < 0) ? 1 : 0);
-    while (numLen < target)
-    {
-      for (uint8_t i = 0; i < numLen + 1; i++)
-      // if negative, skip negative sign
-      {
-        buf[len - i + 1] = buf[len - i];
-        buf[len - i] = '0';
-      }
-      buf[len + 1] = '\0';
-      numLen++;
-      len++;
-    }
-    // insert
-    for (uint8_t i = 0; i < decimal + 1; i++)
-    {
-      buf[len - i + 1] = buf[len - i];
-      buf[len - i] = '.';
-    }
-    // clearBuffer(buf);
-    // snprintf(buf, STRING_LENGTH, "%d", target);
-  }
-  return strlen(buf);
+  uint8_t len = (uint8_t)(digits + sizeof(digits) - p);
+  uint8_t pad = (width > len) ? width - len : 0;
+  memset(buf, ' ', pad);
+  memcpy(buf + pad, p, len);
+  buf[pad + len] = '\0';
+  return pad + len;
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,245 @@
+#ifndef TREND_PAGE_H
+#define TREND_PAGE_H
+
+// Full-width trend page on the panel's hardware vertical scrolling.
+//
+// The ILI9488 can scroll frame memory along its native long axis (VSCRDEF /
+// VSCRSADD), which in the landscape rotations is screen x. The page keeps a
+// value panel in one of the fixed areas and treats the scroll area as a
+// circular buffer of columns: a new sample renders its single 320 px column
+// straight into the DMA line buffer, overwrites the oldest memory line and
+// moves the scroll pointer. Scrolling the whole 420 px wide plot costs about
+// 1 KB of SPI per sample instead of a 400 KB redraw. Frame memory itself is
+// never moved, so the page only works in rotation 1 or 3.
+
+#include <TFT_eSPI.h>
+#include "gauge_sprite.h"
+#include "dma_push.h"
+
+#ifndef ILI9488_NORON
+#define ILI9488_NORON 0x13
+#endif
+#ifndef ILI9488_VSCRDEF
+#define ILI9488_VSCRDEF 0x33
+#endif
+#ifndef ILI9488_VSCRSADD
+#define ILI9488_VSCRSADD 0x37
+#endif
+
+#define TREND_CHANNELS 4
+#define TREND_LINES TFT_HEIGHT                      // memory lines along the scroll axis
+#define TREND_COLUMN TFT_WIDTH                      // pixels per column
+#define TREND_PANEL_W 60                            // fixed value panel on the right
+#define TREND_PLOT_W (TREND_LINES - TREND_PANEL_W)
+#define TREND_BAND_H (TREND_COLUMN / TREND_CHANNELS)
+#define TREND_GRID_EVERY 4   // grid dots on every 4th column
+#define TREND_PANEL_EVERY 5  // value panel refresh, in samples
+
+struct TrendChannel {
+  const char* label;
+  int16_t minValue, maxValue, gridStep;
+  uint8_t decimals;  // value is in tenths when 1
+  uint16_t color;
+};
+
+struct TrendPage {
+  const TrendChannel* channels;  // TREND_CHANNELS of them
+  bool active;
+  bool flipped;                  // rotation 3: screen x runs against memory lines
+  int16_t tfa, vsa, bfa;
+  int16_t head;                  // memory line holding the newest column
+  int16_t lastRow[TREND_CHANNELS];
+  uint32_t samples;
+  uint8_t* base666;              // background column without and with grid dots
+  uint8_t* spans;                // per memory line, first and last trace row of each band; 0xFF if unused
+  int16_t labelW[TREND_CHANNELS], labelH;
+  uint8_t trace666[TREND_CHANNELS][3];
+  GaugeSprite values[TREND_CHANNELS];
+};
+
+static void trendWrite16(uint16_t v) {
+  display.writedata(v >> 8);
+  display.writedata(v & 0xFF);
+}
+
+// Top fixed area, scroll area and bottom fixed area, in memory lines
+void trendScrollDefine(uint16_t tfa, uint16_t vsa, uint16_t bfa) {
+  dmaPushFlush();
+  display.writecommand(ILI9488_VSCRDEF);
+  trendWrite16(tfa);
+  trendWrite16(vsa);
+  trendWrite16(bfa);
+}
+
+// Memory line shown on the first line of the scroll area
+void trendScrollTo(uint16_t vsp) {
+  dmaPushFlush();
+  display.writecommand(ILI9488_VSCRSADD);
+  trendWrite16(vsp);
+}
+
+// Screen x of memory line `line`, with scrolling off
+static int16_t trendScreenX(const TrendPage& page, int16_t line) {
+  return page.flipped ? TREND_LINES - 1 - line : line;
+}
+
+// Row of `value` inside its band, two pixels clear of the separators
+static int16_t trendRow(const TrendChannel& ch, int32_t value) {
+  value = constrain(value, ch.minValue, ch.maxValue);
+  return (TREND_BAND_H - 3) - (value - ch.minValue) * (TREND_BAND_H - 5) / (ch.maxValue - ch.minValue);
+}
+
+static void trendBuildBase(TrendPage& page) {
+  uint8_t bg[3], separator[3], grid[3];
+  rgb565ToRgb666Pixel(0x0000, bg);
+  uint16_t s = TFT_DARKGREY, g = 0x39E7;  // grey 25%
+  rgb565ToRgb666Pixel((uint16_t)((s >> 8) | (s << 8)), separator);
+  rgb565ToRgb666Pixel((uint16_t)((g >> 8) | (g << 8)), grid);
+  for (uint8_t withGrid = 0; withGrid < 2; withGrid++) {
+    uint8_t* col = page.base666 + withGrid * TREND_COLUMN * 3;
+    for (int16_t y = 0; y < TREND_COLUMN; y++) memcpy(col + y * 3, (y % TREND_BAND_H == 0 && y) ? separator : bg, 3);
+    if (!withGrid) continue;
+    for (uint8_t c = 0; c < TREND_CHANNELS; c++) {
+      const TrendChannel& ch = page.channels[c];
+      for (int32_t v = ch.minValue; ch.gridStep > 0 && v <= ch.maxValue; v += ch.gridStep) {
+        memcpy(col + (c * TREND_BAND_H + trendRow(ch, v)) * 3, grid, 3);
+      }
+    }
+  }
+}
+
+struct TrendColumn {
+  const TrendPage* page;
+  const uint8_t* base;
+  int16_t from[TREND_CHANNELS], to[TREND_CHANNELS];  // trace span per band, inclusive
+};
+
+static void dmaFillTrendColumn(uint8_t* dst, int16_t line, int16_t lines, int16_t width, void* ctx) {
+  (void)width;  // always 1
+  const TrendColumn* col = (const TrendColumn*)ctx;
+  memcpy(dst, col->base + line * 3, lines * 3);
+  for (uint8_t c = 0; c < TREND_CHANNELS; c++) {
+    int16_t from = max((int32_t)c * TREND_BAND_H + col->from[c], (int32_t)line);
+    int16_t to = min((int32_t)c * TREND_BAND_H + col->to[c], (int32_t)line + lines - 1);
+    for (int16_t y = from; y <= to; y++) memcpy(dst + (y - line) * 3, col->page->trace666[c], 3);
+  }
+}
+
+static void trendPanelValues(TrendPage& page, const int16_t* values) {
+  for (uint8_t c = 0; c < TREND_CHANNELS; c++) {
+    GaugeSprite& g = page.values[c];
+    if (g.shown == values[c]) continue;
+    gaugeSpriteDrawValue(g, values[c], page.channels[c].decimals, TREND_PANEL_W / 2, 0);
+    gaugeSpritePush(g, TREND_PLOT_W, c * TREND_BAND_H + 34);
+  }
+}
+
+// Draw the panel labels and switch the panel to scrolling; the screen must already be
+// black. Returns false (and leaves the screen alone) outside the landscape rotations.
+bool trendPageBegin(TrendPage& page, const TrendChannel* channels) {
+  uint8_t rotation = display.getRotation() & 3;
+  if (rotation != 1 && rotation != 3) return false;
+  if (!page.base666) page.base666 = (uint8_t*)malloc(2 * TREND_COLUMN * 3 + TREND_LINES * TREND_CHANNELS * 2);
+  if (!page.base666) return false;
+  page.spans = page.base666 + 2 * TREND_COLUMN * 3;
+  memset(page.spans, 0xFF, TREND_LINES * TREND_CHANNELS * 2);
+
+  page.channels = channels;
+  page.flipped = rotation == 3;
+  // The panel sits at screen x >= TREND_PLOT_W: the top fixed area when flipped, else the bottom one
+  page.tfa = page.flipped ? TREND_PANEL_W : 0;
+  page.vsa = TREND_PLOT_W;
+  page.bfa = page.flipped ? 0 : TREND_PANEL_W;
+  page.head = page.flipped ? page.tfa : page.tfa + page.vsa - 1;  // as if the newest column were just left of the panel
+  page.samples = 0;
+  for (uint8_t c = 0; c < TREND_CHANNELS; c++) {
+    page.lastRow[c] = -1;
+    uint16_t color = channels[c].color;
+    rgb565ToRgb666Pixel((uint16_t)((color >> 8) | (color << 8)), page.trace666[c]);
+  }
+  trendBuildBase(page);
+
+  dmaPushFlush();
+  display.loadFont(AA_FONT_SMALL);
+  display.setTextDatum(TC_DATUM);
+  page.labelH = display.fontHeight();
+  for (uint8_t c = 0; c < TREND_CHANNELS; c++) {
+    display.setTextColor(channels[c].color, TFT_BLACK);
+    display.drawString(channels[c].label, TREND_PLOT_W + TREND_PANEL_W / 2, c * TREND_BAND_H + 8);
+    page.labelW[c] = min((int32_t)TREND_PANEL_W, (int32_t)display.textWidth(channels[c].label) + 2);
+    GaugeSprite& g = page.values[c];
+    gaugeSpriteBegin(g, TREND_PANEL_W, 24, AA_FONT_SMALL, TC_DATUM);
+    g.shown = INT32_MIN;
+  }
+  display.unloadFont();
+
+  trendScrollDefine(page.tfa, page.vsa, page.bfa);
+  trendScrollTo(page.tfa);
+  page.active = true;
+  return true;
+}
+
+// Add one column per channel value (in the channel's units) and scroll by one pixel
+void trendPageSample(TrendPage& page, const int16_t* values) {
+  if (!page.active || !dmaPushBuf[0]) return;
+  TrendColumn col = { &page, page.base666 + ((page.samples % TREND_GRID_EVERY) ? 0 : TREND_COLUMN * 3), {}, {} };
+  for (uint8_t c = 0; c < TREND_CHANNELS; c++) {
+    int16_t row = trendRow(page.channels[c], values[c]);
+    int16_t from = (page.lastRow[c] < 0) ? row : page.lastRow[c];
+    col.from[c] = min(row, from);
+    col.to[c] = max(row, from);
+    page.lastRow[c] = row;
+  }
+
+  // Overwrite the oldest memory line, then point the scroll area so it shows up last
+  int16_t offset = page.head - page.tfa + (page.flipped ? page.vsa - 1 : 1);
+  page.head = page.tfa + offset % page.vsa;
+  uint8_t* span = page.spans + page.head * TREND_CHANNELS * 2;
+  for (uint8_t c = 0; c < TREND_CHANNELS; c++) {
+    span[c * 2] = col.from[c];
+    span[c * 2 + 1] = col.to[c];
+  }
+  pushWindowDMA(trendScreenX(page, page.head), 0, 1, TREND_COLUMN, dmaFillTrendColumn, &col);
+  int16_t newest = page.flipped ? 0 : page.vsa - 1;  // in scroll-area lines
+  trendScrollTo(page.tfa + (page.head - page.tfa - newest + page.vsa) % page.vsa);
+
+  if (page.samples % TREND_PANEL_EVERY == 0) trendPanelValues(page, values);
+  page.samples++;
+}
+
+// Paint out the page, which is far cheaper than a full clear: every trace span that was
+// written, the separator and grid rows across the plot, and the panel text
+static void trendErase(TrendPage& page) {
+  dmaPushFlush();
+  for (int16_t line = 0; line < TREND_LINES; line++) {
+    const uint8_t* span = page.spans + line * TREND_CHANNELS * 2;
+    for (uint8_t c = 0; c < TREND_CHANNELS; c++, span += 2) {
+      if (span[0] == 0xFF) continue;
+      display.fillRect(trendScreenX(page, line), c * TREND_BAND_H + span[0], 1, span[1] - span[0] + 1, TFT_BLACK);
+    }
+  }
+  for (uint8_t c = 0; c < TREND_CHANNELS; c++) {
+    const TrendChannel& ch = page.channels[c];
+    if (c) display.fillRect(0, c * TREND_BAND_H, TREND_PLOT_W, 1, TFT_BLACK);
+    for (int32_t v = ch.minValue; ch.gridStep > 0 && v <= ch.maxValue; v += ch.gridStep) {
+      display.fillRect(0, c * TREND_BAND_H + trendRow(ch, v), TREND_PLOT_W, 1, TFT_BLACK);
+    }
+    display.fillRect(TREND_PLOT_W + (TREND_PANEL_W - page.labelW[c]) / 2, c * TREND_BAND_H + 8, page.labelW[c],
+                     page.labelH, TFT_BLACK);
+    gaugeSpriteErase(page.values[c], TREND_PLOT_W, c * TREND_BAND_H + 34);
+  }
+}
+
+// Back to plain addressing, leaving a black screen
+void trendPageEnd(TrendPage& page) {
+  if (!page.active) return;
+  page.active = false;
+  trendScrollDefine(0, TREND_LINES, 0);
+  trendScrollTo(0);
+  display.writecommand(ILI9488_NORON);
+  trendErase(page);
+  free(page.base666);
+  page.base666 = page.spans = nullptr;
+}
+
+#endif
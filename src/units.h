@@ -0,0 +1,79 @@
+#ifndef UNITS_H
+#define UNITS_H
+
+// Display units per channel, converted without float.
+//
+// The ECU reports temperatures in degrees C, MAP in kPa and AFR in tenths.
+// Each channel can instead be shown as degrees F, psi or lambda. Temperatures
+// and AFR come off the wire as single bytes, so their alternatives are
+// 256-entry tables built by constexpr code and indexed by that byte: a
+// Fahrenheit box costs one load, the same as Celsius. MAP is a word, so psi
+// is a Q20 multiplier worked out at compile time - one multiply and a shift.
+
+#include <stdint.h>
+
+enum UnitChannel { UNIT_CLT, UNIT_IAT, UNIT_MAP, UNIT_AFR, UNIT_CHANNELS };
+
+// One bit per channel: clear = the ECU's unit, set = the alternative
+#define UNIT_ALT(channel) (1 << (channel))
+#define UNITS_EEPROM_ADDR 3
+#define UNITS_EEPROM_TAG 0xA0  // high nibble marks a stored selection; erased flash reads 0xFF
+#define UNITS_MASK ((1 << UNIT_CHANNELS) - 1)
+
+#define TEMP_OFFSET 40          // temperature byte = degrees C + 40
+#define AFR_STOICH_TENTHS 147   // petrol
+#define PSI_PER_KPA 0.1450377377
+#define PSI_MAX_KPA 2047        // keeps the Q20 product inside 32 bits
+
+struct UnitTable {
+  int16_t v[256];
+};
+
+// Integer division rounding half away from zero
+constexpr int32_t unitDivRound(int32_t n, int32_t d) { return (n >= 0) ? (n + d / 2) / d : -((-n + d / 2) / d); }
+
+constexpr UnitTable makeFahrenheitTable() {
+  UnitTable t = {};
+  for (int32_t i = 0; i < 256; i++) t.v[i] = (int16_t)(unitDivRound((i - TEMP_OFFSET) * 9, 5) + 32);
+  return t;
+}
+
+// AFR tenths -> lambda hundredths
+constexpr UnitTable makeLambdaTable() {
+  UnitTable t = {};
+  for (int32_t i = 0; i < 256; i++) t.v[i] = (int16_t)unitDivRound(i * 100, AFR_STOICH_TENTHS);
+  return t;
+}
+
+constexpr UnitTable fahrenheitTable = makeFahrenheitTable();
+constexpr UnitTable lambdaTable = makeLambdaTable();
+constexpr uint32_t PSI_TENTHS_PER_KPA_Q20 = (uint32_t)(PSI_PER_KPA * 10 * (1 << 20) + 0.5);
+
+static_assert(fahrenheitTable.v[TEMP_OFFSET] == 32 && fahrenheitTable.v[TEMP_OFFSET + 100] == 212, "0 C = 32 F, 100 C = 212 F");
+static_assert(lambdaTable.v[AFR_STOICH_TENTHS] == 100, "stoichiometric is lambda 1.00");
+
+static inline uint8_t unitByte(int32_t v) { return (v < 0) ? 0 : (v > 255) ? 255 : (uint8_t)v; }
+
+// Whole degrees F
+static inline int32_t unitFahrenheit(int32_t celsius) { return fahrenheitTable.v[unitByte(celsius + TEMP_OFFSET)]; }
+
+// psi in tenths
+static inline int32_t unitPsiTenths(int32_t kpa) {
+  uint32_t clamped = (kpa < 0) ? 0 : (kpa > PSI_MAX_KPA) ? PSI_MAX_KPA : kpa;
+  return (int32_t)((clamped * PSI_TENTHS_PER_KPA_Q20 + (1 << 19)) >> 20);
+}
+
+// Lambda in hundredths
+static inline int32_t unitLambdaHundredths(int32_t afrTenths) { return lambdaTable.v[unitByte(afrTenths)]; }
+
+static inline const char* unitName(uint8_t channel, bool alt) {
+  static const char* const names[UNIT_CHANNELS][2] = { { "C", "F" }, { "C", "F" }, { "kPa", "psi" }, { "AFR", "lambda" } };
+  return names[channel][alt];
+}
+
+static inline const char* unitChannelName(uint8_t channel) {
+  static const char* const names[UNIT_CHANNELS] = { "clt", "iat", "map", "afr" };
+  return names[channel];
+}
+
+#endif
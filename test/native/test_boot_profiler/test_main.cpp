@@ -0,0 +1,75 @@
+// Boot timeline: per-stage times in start order, repeated stages summed
+//   pio test -e native -f native/test_boot_profiler
+#include <unity.h>
+#include <string.h>
+#include "boot_profiler.h"
+
+static BootTimeline timeline;
+
+void setUp(void) { bootTimelineBegin(timeline); }
+void tearDown(void) {}
+
+void test_records_and_sums(void) {
+  bootTimelineRecord(timeline, BOOT_STAGE_DISPLAY, 100, 40100);
+  bootTimelineRecord(timeline, BOOT_STAGE_ECU_PROBE, 50000, 50300);
+  bootTimelineRecord(timeline, BOOT_STAGE_ECU_PROBE, 90000, 110000);
+  TEST_ASSERT_EQUAL_UINT32(40000, timeline.stages[BOOT_STAGE_DISPLAY].us);
+  TEST_ASSERT_EQUAL_UINT32(50000, timeline.stages[BOOT_STAGE_ECU_PROBE].startUs);  // the first call
+  TEST_ASSERT_EQUAL_UINT32(20300, timeline.stages[BOOT_STAGE_ECU_PROBE].us);
+  TEST_ASSERT_EQUAL_INT(2, timeline.stages[BOOT_STAGE_ECU_PROBE].calls);
+  TEST_ASSERT_EQUAL_INT(0, timeline.stages[BOOT_STAGE_WIFI].calls);
+}
+
+// Nested stages print in the order they started; stages never reached are left out
+void test_format_in_start_order(void) {
+  char text[768];
+  bootTimelineRecord(timeline, BOOT_STAGE_WIFI, 2000, 2150);  // inside the sequencer
+  bootTimelineRecord(timeline, BOOT_STAGE_SEQUENCER, 1000, 3000);
+  bootTimelineRecord(timeline, BOOT_STAGE_DISPLAY, 10, 900);
+  bootTimelineFormat(timeline, text, sizeof(text));
+  const char* display = strstr(text, "display.init");
+  const char* sequencer = strstr(text, "bootSequencer");
+  const char* wifi = strstr(text, "WiFi.softAP");
+  TEST_ASSERT_TRUE(display && sequencer && wifi);
+  TEST_ASSERT_TRUE(display < sequencer && sequencer < wifi);
+  TEST_ASSERT_NULL(strstr(text, "server.begin"));
+  TEST_ASSERT_NOT_NULL(strstr(text, "setup() did not finish"));
+
+  bootTimelineEnd(timeline, 3500);
+  bootTimelineFormat(timeline, text, sizeof(text));
+  TEST_ASSERT_NOT_NULL(strstr(text, "setup() done at 3500 us"));
+}
+
+// What RTC memory holds after a power-on is rejected, and a short buffer is never overrun
+void test_invalid_and_truncated(void) {
+  char text[40];
+  BootTimeline noise;
+  memset(&noise, 0xA5, sizeof(noise));
+  TEST_ASSERT_FALSE(bootTimelineValid(noise));
+  bootTimelineFormat(noise, text, sizeof(text));
+  TEST_ASSERT_EQUAL_STRING("no boot timeline\n", text);
+
+  for (uint8_t i = 0; i < BOOT_STAGE_COUNT; i++) bootTimelineRecord(timeline, (BootStageId)i, i * 10, i * 10 + 5);
+  size_t len = bootTimelineFormat(timeline, text, sizeof(text));
+  TEST_ASSERT_EQUAL_UINT32(sizeof(text) - 1, len);
+  TEST_ASSERT_EQUAL_UINT32(len, strlen(text));
+}
+
+// The scope measures the block it sits in
+void test_scope(void) {
+  {
+    BootStageScope stage(timeline, BOOT_STAGE_SERVER);
+    hostAdvanceMicros(1500);
+  }
+  TEST_ASSERT_EQUAL_INT(1, timeline.stages[BOOT_STAGE_SERVER].calls);
+  TEST_ASSERT_TRUE(timeline.stages[BOOT_STAGE_SERVER].us >= 1500);
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_records_and_sums);
+  RUN_TEST(test_format_in_start_order);
+  RUN_TEST(test_invalid_and_truncated);
+  RUN_TEST(test_scope);
+  return UNITY_END();
+}
@@ -0,0 +1,126 @@
+// Boot sequencer: start-up work overlaps the splash, which ends on live data or a timeout
+//   pio test -e native -f native/test_boot_sequencer
+#include <unity.h>
+#include "boot_sequencer.h"
+
+static uint32_t now;
+static uint8_t wifiCalls, serverCalls, probes;
+static uint8_t probesUntilLive;  // 0 = the ECU never answers
+static uint32_t serverDoneAt;
+
+static bool fakeWifi() {
+  wifiCalls++;
+  now += 150;  // softAP() is slow
+  return true;
+}
+
+static bool fakeServer() {
+  serverCalls++;
+  now += 5;
+  if (!serverDoneAt) serverDoneAt = now;
+  return serverCalls >= 3;  // needs several slices
+}
+
+static bool fakeProbe() {
+  probes++;
+  now += 20;  // a probe that gets no answer waits out its timeout
+  return probesUntilLive && probes >= probesUntilLive;
+}
+
+static const BootStep steps[] = {
+  { "wifi", fakeWifi },
+  { "server", fakeServer },
+};
+
+// Poll the way setup() does, 1 ms per idle pass; returns when the splash may end
+static uint32_t runBoot(BootSequencer& boot) {
+  bootBegin(boot, steps, 2, fakeProbe, now);
+  uint32_t start = now;
+  for (uint32_t guard = 0; guard < 100000; guard++) {
+    if (bootPoll(boot, now)) return now - start;
+    now++;
+  }
+  TEST_FAIL();
+  return 0;
+}
+
+void setUp(void) {
+  now = 1000;
+  wifiCalls = serverCalls = probes = 0;
+  serverDoneAt = 0;
+}
+void tearDown(void) {}
+
+// ECU answers early: the splash stays only its minimum time
+void test_live_ecu_ends_at_minimum(void) {
+  probesUntilLive = 2;
+  BootSequencer boot;
+  uint32_t shown = runBoot(boot);
+  TEST_ASSERT_TRUE(boot.live);
+  TEST_ASSERT_EQUAL_UINT32(BOOT_SPLASH_MIN_MS, shown);
+  TEST_ASSERT_EQUAL_INT(1, wifiCalls);
+  TEST_ASSERT_EQUAL_INT(3, serverCalls);
+  TEST_ASSERT_EQUAL_INT(2, probes);  // no more once live
+}
+
+// No ECU: keep probing at the interval, give up at the maximum
+void test_no_ecu_ends_at_maximum(void) {
+  probesUntilLive = 0;
+  BootSequencer boot;
+  uint32_t shown = runBoot(boot);
+  TEST_ASSERT_FALSE(boot.live);
+  TEST_ASSERT_TRUE(shown >= BOOT_SPLASH_MAX_MS && shown < BOOT_SPLASH_MAX_MS + BOOT_PROBE_INTERVAL_MS);
+  TEST_ASSERT_TRUE(probes >= BOOT_SPLASH_MAX_MS / (BOOT_PROBE_INTERVAL_MS + 20));
+  TEST_ASSERT_TRUE(probes <= BOOT_SPLASH_MAX_MS / BOOT_PROBE_INTERVAL_MS + 1);
+}
+
+// The first probe goes out before any step, and probes are slotted between steps
+void test_probe_interleaves_with_steps(void) {
+  probesUntilLive = 0;
+  BootSequencer boot;
+  bootBegin(boot, steps, 2, fakeProbe, now);
+  bootPoll(boot, now);
+  TEST_ASSERT_EQUAL_INT(1, probes);
+  TEST_ASSERT_EQUAL_INT(0, wifiCalls);
+  bootPoll(boot, now);
+  TEST_ASSERT_EQUAL_INT(1, wifiCalls);  // the 150 ms step
+  bootPoll(boot, now);
+  TEST_ASSERT_EQUAL_INT(2, probes);  // overdue, so before the next step
+  TEST_ASSERT_EQUAL_INT(0, serverCalls);
+}
+
+// Steps always finish, even past the maximum
+void test_waits_for_steps(void) {
+  static const BootStep slow[] = { { "slow", []() {
+    now += 1000;
+    return ++wifiCalls == 4;
+  } } };
+  probesUntilLive = 1;
+  BootSequencer boot;
+  bootBegin(boot, slow, 1, fakeProbe, now);
+  uint32_t start = now;
+  while (!bootPoll(boot, now)) {
+  }
+  TEST_ASSERT_EQUAL_INT(4, wifiCalls);
+  TEST_ASSERT_TRUE(now - start >= 4000);
+}
+
+// Skip the splash only when the engine is, or was just, running
+void test_warm_path(void) {
+  TEST_ASSERT_EQUAL_INT(BOOT_WARM, bootChoosePath(false, 0, true, 850));                 // ECU says running
+  TEST_ASSERT_EQUAL_INT(BOOT_COLD, bootChoosePath(false, 0, true, 0));                   // key on, engine off
+  TEST_ASSERT_EQUAL_INT(BOOT_COLD, bootChoosePath(false, 0, false, 0));                  // no ECU yet
+  TEST_ASSERT_EQUAL_INT(BOOT_WARM, bootChoosePath(true, bootWarmMarkerFor(3000), false, 0));  // brownout, ECU still booting
+  TEST_ASSERT_EQUAL_INT(BOOT_COLD, bootChoosePath(true, bootWarmMarkerFor(0), false, 0));     // watchdog with the engine off
+  TEST_ASSERT_EQUAL_INT(BOOT_COLD, bootChoosePath(false, bootWarmMarkerFor(3000), false, 0)); // power-on: marker is stale
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_live_ecu_ends_at_minimum);
+  RUN_TEST(test_no_ecu_ends_at_maximum);
+  RUN_TEST(test_probe_interleaves_with_steps);
+  RUN_TEST(test_waits_for_steps);
+  RUN_TEST(test_warm_path);
+  return UNITY_END();
+}
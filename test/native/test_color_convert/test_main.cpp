@@ -0,0 +1,89 @@
+// Host checks and benchmark for the RGB565 -> RGB666 kernel in color_convert.h
+//   pio test -e native -f native/test_color_convert
+#include <unity.h>
+#include <stdio.h>
+#include <vector>
+#include <chrono>
+#include "color_convert.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void convertPerPixel(const uint16_t* src, uint8_t* dst, int32_t count) {
+  for (int32_t i = 0; i < count; i++) {
+    rgb565ToRgb666Pixel(src[i], dst + i * 3);
+  }
+}
+
+void test_run_matches_reference_for_every_colour(void) {
+  std::vector<uint16_t> src(65536);
+  for (uint32_t i = 0; i < src.size(); i++) src[i] = (uint16_t)i;
+  std::vector<uint8_t> expected(src.size() * 3), actual(src.size() * 3);
+
+  convertPerPixel(src.data(), expected.data(), src.size());
+  rgb565ToRgb666Run(src.data(), actual.data(), src.size());
+  TEST_ASSERT_EQUAL_MEMORY(expected.data(), actual.data(), expected.size());
+}
+
+void test_run_handles_tails(void) {
+  uint16_t src[7] = { 0x00F8, 0xE007, 0x1F00, 0xFFFF, 0x0000, 0x10A2, 0xEF7B };
+  for (int32_t n = 0; n <= 7; n++) {
+    uint8_t expected[24] = { 0 }, actual[24] = { 0 };
+    convertPerPixel(src, expected, n);
+    rgb565ToRgb666Run(src, actual, n);
+    TEST_ASSERT_EQUAL_MEMORY(expected, actual, sizeof(expected));
+  }
+}
+
+void test_primaries(void) {
+  // Stored byte-swapped: TFT_RED 0xF800 is 0x00F8 in memory order
+  uint8_t out[3];
+  rgb565ToRgb666Pixel(0x00F8, out);
+  TEST_ASSERT_EQUAL_HEX8(0xF8, out[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x00, out[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x00, out[2]);
+  rgb565ToRgb666Pixel(0xE007, out);  // TFT_GREEN 0x07E0
+  TEST_ASSERT_EQUAL_HEX8(0x00, out[0]);
+  TEST_ASSERT_EQUAL_HEX8(0xFC, out[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x00, out[2]);
+  rgb565ToRgb666Pixel(0x1F00, out);  // TFT_BLUE 0x001F
+  TEST_ASSERT_EQUAL_HEX8(0x00, out[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x00, out[1]);
+  TEST_ASSERT_EQUAL_HEX8(0xF8, out[2]);
+}
+
+template <typename F>
+static double megapixelsPerSecond(F convert, const uint16_t* src, uint8_t* dst, int32_t count, int rounds) {
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; r++) {
+    convert(src, dst, count);
+    __asm__ __volatile__("" : : "r"(dst) : "memory");
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  return (double)count * rounds / elapsed.count() / 1e6;
+}
+
+void test_benchmark(void) {
+  // One gauge sprite worth of pixels (100 x 40), the size of a DMA chunk
+  const int32_t count = 4000;
+  const int rounds = 20000;
+  std::vector<uint16_t> src(count);
+  for (int32_t i = 0; i < count; i++) src[i] = (uint16_t)(i * 2654435761u >> 16);
+  std::vector<uint8_t> dst(count * 3);
+
+  double perPixel = megapixelsPerSecond(convertPerPixel, src.data(), dst.data(), count, rounds);
+  double run = megapixelsPerSecond(rgb565ToRgb666Run, src.data(), dst.data(), count, rounds);
+
+  char msg[96];
+  snprintf(msg, sizeof(msg), "per-pixel %.1f Mpx/s, word-at-a-time %.1f Mpx/s (%.2fx)", perPixel, run, run / perPixel);
+  TEST_MESSAGE(msg);
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_run_matches_reference_for_every_colour);
+  RUN_TEST(test_run_handles_tails);
+  RUN_TEST(test_primaries);
+  RUN_TEST(test_benchmark);
+  return UNITY_END();
+}
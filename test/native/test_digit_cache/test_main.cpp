@@ -0,0 +1,81 @@
+// Digit cache: numbers copied from pre-rendered glyphs match drawString() pixel for pixel
+//   pio test -e native -f native/test_digit_cache
+#include <unity.h>
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <vector>
+#include "NotoSansBold36.h"
+
+TFT_eSPI display = TFT_eSPI();
+
+#include "digit_cache.h"
+
+static TFT_eSprite* makeSprite(int16_t w, int16_t h, uint8_t datum) {
+  TFT_eSprite* s = new TFT_eSprite(&display);
+  s->setColorDepth(4);
+  s->createSprite(w, h);
+  s->loadFont(NotoSansBold36);
+  s->setTextDatum(datum);
+  s->setTextColor(15, 0, true);
+  return s;
+}
+
+static std::vector<uint8_t> spriteBytes(TFT_eSprite& s) {
+  const uint8_t* p = (const uint8_t*)s.getPointer();
+  return std::vector<uint8_t>(p, p + (s.width() + 1) / 2 * s.height());
+}
+
+// Every value drawn both ways, into the RPM readout's sprite and a data box's
+static void checkSame(uint8_t datum, int16_t w, int16_t h, int32_t x, int32_t y) {
+  TFT_eSprite* s = makeSprite(w, h, datum);
+  DigitCache cache = {};
+  TEST_ASSERT_TRUE(digitCacheBuild(cache, *s, datum, y));
+  TEST_ASSERT_EQUAL_INT(datum, s->getTextDatum());
+  for (int32_t value = 0; value <= 9999; value += (value < 200) ? 1 : 37) {
+    char text[8];
+    snprintf(text, sizeof(text), "%ld", (long)value);
+    s->fillSprite(0);
+    s->drawString(text, x, y);
+    std::vector<uint8_t> expected = spriteBytes(*s);
+    s->fillSprite(0);
+    TEST_ASSERT_TRUE(digitCacheDraw(cache, *s, text, x, y));
+    if (spriteBytes(*s) != expected) {
+      TEST_FAIL_MESSAGE(text);
+      return;
+    }
+  }
+  free(cache.ink);
+  delete s;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_matches_draw_string_right_aligned(void) { checkSame(TR_DATUM, 100, 50, 100, 5); }
+void test_matches_draw_string_centred(void) { checkSame(TC_DATUM, 100, 40, 50, 5); }
+
+// Anything that isn't plain digits at the cached row is left to drawString()
+void test_declines_what_it_cannot_draw(void) {
+  TFT_eSprite* s = makeSprite(100, 50, TR_DATUM);
+  DigitCache cache = {};
+  TEST_ASSERT_FALSE(digitCacheDraw(cache, *s, "123", 100, 5));  // not built
+  TEST_ASSERT_TRUE(digitCacheBuild(cache, *s, TR_DATUM, 5));
+  s->fillSprite(0);
+  TEST_ASSERT_FALSE(digitCacheDraw(cache, *s, "-12", 100, 5));
+  TEST_ASSERT_FALSE(digitCacheDraw(cache, *s, "14.7", 100, 5));
+  TEST_ASSERT_FALSE(digitCacheDraw(cache, *s, "", 100, 5));
+  TEST_ASSERT_FALSE(digitCacheDraw(cache, *s, "123", 100, 6));
+  std::vector<uint8_t> blank = spriteBytes(*s);
+  for (uint8_t b : blank) TEST_ASSERT_EQUAL_HEX8(0, b);
+  free(cache.ink);
+  delete s;
+}
+
+int main(int argc, char** argv) {
+  display.init();
+  UNITY_BEGIN();
+  RUN_TEST(test_matches_draw_string_right_aligned);
+  RUN_TEST(test_matches_draw_string_centred);
+  RUN_TEST(test_declines_what_it_cannot_draw);
+  return UNITY_END();
+}
@@ -0,0 +1,28 @@
+// Scaled-integer channel values
+//   pio test -e native -f native/test_fixed_point
+#include <unity.h>
+#include "fixed_point.h"
+
+static_assert(Fixed<1>::decimals == 0 && Tenths::decimals == 1 && Fixed<1000>::decimals == 3, "decimals follow the scale");
+static_assert(Tenths::fromWhole(14) + Tenths::fromRaw(7) == Tenths::fromRaw(147), "14 + 0.7 is 14.7");
+static_assert(Tenths::fromRaw(-19).whole() == -1, "whole() truncates toward zero");
+static_assert(!fixedPowerOfTen(0) && !fixedPowerOfTen(16) && fixedPowerOfTen(100), "only powers of ten scale");
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_compare(void) {
+  const Tenths rich = Tenths::fromRaw(130);
+  TEST_ASSERT_TRUE(Tenths::fromRaw(129) < rich);
+  TEST_ASSERT_FALSE(Tenths::fromWhole(13) < rich);
+  TEST_ASSERT_TRUE(Tenths::fromWhole(13) <= rich);
+  TEST_ASSERT_TRUE(Tenths::fromRaw(148) > Tenths::fromRaw(147));
+  TEST_ASSERT_TRUE(Tenths::fromRaw(148) - Tenths::fromRaw(147) == Tenths::fromRaw(1));
+  TEST_ASSERT_TRUE(Tenths::fromRaw(1) != Tenths::fromRaw(-1));
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_compare);
+  return UNITY_END();
+}
@@ -0,0 +1,61 @@
+// Per-gauge deadband / settle / minimum interval filter
+//   pio test -e native -f native/test_gauge_filter
+#include <unity.h>
+#include "gauge_filter.h"
+
+static const GaugeFilterConfig config = { 1, 250, 250 };
+static GaugeFilter filter;
+
+void setUp(void) { filter = GaugeFilter(); }
+void tearDown(void) {}
+
+void test_first_reading_passes_through(void) {
+  TEST_ASSERT_EQUAL_INT32(35, gaugeFilterApply(filter, config, 35, 0));
+}
+
+void test_one_count_jitter_is_held(void) {
+  gaugeFilterApply(filter, config, 35, 0);
+  for (uint32_t t = 20; t < 5000; t += 20) {
+    int32_t raw = (t / 20) & 1 ? 36 : 35;
+    TEST_ASSERT_EQUAL_INT32(35, gaugeFilterApply(filter, config, raw, t));
+  }
+}
+
+void test_jitter_either_side_is_held(void) {
+  gaugeFilterApply(filter, config, 35, 0);
+  for (uint32_t t = 20; t < 5000; t += 20) {
+    int32_t raw = (t / 20) & 1 ? 36 : 34;
+    TEST_ASSERT_EQUAL_INT32(35, gaugeFilterApply(filter, config, raw, t));
+  }
+}
+
+void test_big_step_shows_in_the_same_frame(void) {
+  gaugeFilterApply(filter, config, 35, 0);
+  TEST_ASSERT_EQUAL_INT32(80, gaugeFilterApply(filter, config, 80, 20));
+  TEST_ASSERT_EQUAL_INT32(30, gaugeFilterApply(filter, config, 30, 40));
+}
+
+void test_small_change_shows_once_settled(void) {
+  gaugeFilterApply(filter, config, 35, 0);
+  TEST_ASSERT_EQUAL_INT32(35, gaugeFilterApply(filter, config, 36, 300));
+  TEST_ASSERT_EQUAL_INT32(35, gaugeFilterApply(filter, config, 36, 500));
+  TEST_ASSERT_EQUAL_INT32(36, gaugeFilterApply(filter, config, 36, 560));
+}
+
+void test_zero_deadband_passes_everything(void) {
+  const GaugeFilterConfig exact = { 0, 0, 0 };
+  gaugeFilterApply(filter, exact, 10, 0);
+  TEST_ASSERT_EQUAL_INT32(11, gaugeFilterApply(filter, exact, 11, 1));
+  TEST_ASSERT_EQUAL_INT32(10, gaugeFilterApply(filter, exact, 10, 2));
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_first_reading_passes_through);
+  RUN_TEST(test_one_count_jitter_is_held);
+  RUN_TEST(test_jitter_either_side_is_held);
+  RUN_TEST(test_big_step_shows_in_the_same_frame);
+  RUN_TEST(test_small_change_shows_once_settled);
+  RUN_TEST(test_zero_deadband_passes_everything);
+  return UNITY_END();
+}
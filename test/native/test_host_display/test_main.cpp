@@ -0,0 +1,100 @@
+// Host display backend: rendering, traffic accounting and the gauge push path
+//   pio test -e native -f native/test_host_display
+#include <unity.h>
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "NotoSansBold15.h"
+#include "NotoSansBold36.h"
+
+TFT_eSPI display = TFT_eSPI();
+
+#include "dma_push.h"
+#include "gauge_sprite.h"
+
+static uint32_t countPixels(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+  uint32_t n = 0;
+  for (int32_t j = y; j < y + h; j++)
+    for (int32_t i = x; i < x + w; i++) n += display.pixelAt(i, j) == color;
+  return n;
+}
+
+void setUp(void) {
+  display.init();
+  display.setRotation(3);
+  display.fillScreen(TFT_BLACK);
+  display.resetStats();
+}
+
+void tearDown(void) {}
+
+void test_rotation_is_landscape(void) {
+  TEST_ASSERT_EQUAL_INT(480, display.width());
+  TEST_ASSERT_EQUAL_INT(320, display.height());
+}
+
+void test_fill_rect_costs_one_window(void) {
+  display.fillRect(10, 20, 30, 40, TFT_RED);
+  TEST_ASSERT_EQUAL_UINT32(1, display.stats.windows);
+  TEST_ASSERT_EQUAL_UINT32(HOST_WINDOW_BYTES + 30 * 40 * 3, display.stats.spiBytes);
+  TEST_ASSERT_EQUAL_UINT32(30 * 40, countPixels(0, 0, 480, 320, TFT_RED));
+}
+
+void test_draw_pixel_costs_a_window_per_pixel(void) {
+  for (int i = 0; i < 10; i++) display.drawPixel(i, 0, TFT_WHITE);
+  TEST_ASSERT_EQUAL_UINT32(10, display.stats.windows);
+  TEST_ASSERT_EQUAL_UINT32(10 * (HOST_WINDOW_BYTES + 3), display.stats.spiBytes);
+}
+
+void test_smooth_font_renders_and_measures(void) {
+  display.loadFont(NotoSansBold15);
+  display.setTextColor(TFT_WHITE, TFT_BLACK);
+  display.setTextDatum(TC_DATUM);
+  int16_t w = display.drawString("RPM", 240, 120);
+  TEST_ASSERT_GREATER_THAN(20, w);
+  TEST_ASSERT_GREATER_THAN(30, countPixels(240 - w / 2, 120, w, display.fontHeight(), TFT_WHITE));
+  TEST_ASSERT_EQUAL_UINT32(0, countPixels(0, 0, 480, 100, TFT_WHITE));
+}
+
+void test_gauge_sprite_pushes_through_dma_path(void) {
+  initDmaPush();
+  GaugeSprite gauge = {};
+  gaugeSpriteBegin(gauge, 100, 40, NotoSansBold36, TC_DATUM);
+  gauge.sprite->fillSprite(0);
+  gauge.sprite->drawNumber(88, 50, 5);
+  gaugeSpritePush(gauge, 100, 100);
+  dmaPushFlush();
+
+  TEST_ASSERT_EQUAL_UINT32(100 * 40 * 3 + HOST_WINDOW_BYTES, display.stats.spiBytes);
+  uint32_t white = countPixels(100, 100, 100, 40, TFT_WHITE);
+  TEST_ASSERT_GREATER_THAN(100, white);
+
+  // Recolouring is a palette change: same pixels, new colour
+  TEST_ASSERT_TRUE(gaugeSpriteSetColor(gauge, TFT_RED));
+  gaugeSpritePush(gauge, 100, 100);
+  dmaPushFlush();
+  TEST_ASSERT_EQUAL_UINT32(white, countPixels(100, 100, 100, 40, TFT_RED));
+  TEST_ASSERT_EQUAL_UINT32(0, countPixels(100, 100, 100, 40, TFT_WHITE));
+}
+
+void test_ppm_dump(void) {
+  display.fillRect(0, 0, 10, 10, TFT_GREEN);
+  TEST_ASSERT_TRUE(display.savePPM("host_display_test.ppm"));
+  FILE* f = fopen("host_display_test.ppm", "rb");
+  TEST_ASSERT_TRUE(f != nullptr);
+  char magic[3] = { 0 };
+  TEST_ASSERT_EQUAL_INT(2, (int)fread(magic, 1, 2, f));
+  fclose(f);
+  remove("host_display_test.ppm");
+  TEST_ASSERT_EQUAL_STRING("P6", magic);
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_rotation_is_landscape);
+  RUN_TEST(test_fill_rect_costs_one_window);
+  RUN_TEST(test_draw_pixel_costs_a_window_per_pixel);
+  RUN_TEST(test_smooth_font_renders_and_measures);
+  RUN_TEST(test_gauge_sprite_pushes_through_dma_path);
+  RUN_TEST(test_ppm_dump);
+  return UNITY_END();
+}
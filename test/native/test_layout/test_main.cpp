@@ -0,0 +1,171 @@
+// Main page layout file: the shipped data/layout.bin, what layoutParse() refuses,
+// and label tiles kept on screen
+//   pio test -e native -f native/test_layout
+#include <unity.h>
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <stdio.h>
+#include <vector>
+#include "NotoSansBold15.h"
+#include "NotoSansBold36.h"
+
+#define AA_FONT_SMALL NotoSansBold15
+#define AA_FONT_LARGE NotoSansBold36
+
+TFT_eSPI display = TFT_eSPI();
+TFT_eSprite spr = TFT_eSprite(&display);
+
+#include "dma_push.h"
+#include "dashboard.h"
+
+static std::vector<uint8_t> shippedLayout() {
+  std::vector<uint8_t> data(LAYOUT_MAX_BYTES + 1);
+  FILE* f = fopen("data/layout.bin", "rb");
+  TEST_ASSERT_TRUE(f != nullptr);
+  data.resize(fread(data.data(), 1, data.size(), f));
+  fclose(f);
+  return data;
+}
+
+static uint8_t* record(std::vector<uint8_t>& data, uint8_t i) { return data.data() + LAYOUT_HEADER_BYTES + i * LAYOUT_RECORD_BYTES; }
+
+static bool parses(const std::vector<uint8_t>& data) {
+  DashLayout layout;
+  return layoutParse(data.data(), data.size(), layout);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_shipped_file_matches_builtin(void) {
+  std::vector<uint8_t> data = shippedLayout();
+  DashLayout parsed;
+  TEST_ASSERT_TRUE(layoutParse(data.data(), data.size(), parsed));
+  TEST_ASSERT_EQUAL_INT(dashLayout.count, parsed.count);
+  TEST_ASSERT_EQUAL_INT(dashLayout.fastCount, parsed.fastCount);
+  for (uint8_t i = 0; i < parsed.count; i++) {
+    const LayoutWidget& a = dashLayout.widgets[i];
+    const LayoutWidget& b = parsed.widgets[i];
+    TEST_ASSERT_EQUAL_INT(a.channel, b.channel);
+    TEST_ASSERT_EQUAL_INT(a.flags, b.flags);
+    TEST_ASSERT_EQUAL_INT(a.colorRule, b.colorRule);
+    TEST_ASSERT_EQUAL_INT(a.x, b.x);
+    TEST_ASSERT_EQUAL_INT(a.y, b.y);
+    TEST_ASSERT_EQUAL_HEX16(a.color, b.color);
+    TEST_ASSERT_EQUAL_HEX16(a.labelColor, b.labelColor);
+    TEST_ASSERT_EQUAL_MEMORY(a.label, b.label, LAYOUT_LABEL_LEN);
+  }
+}
+
+void test_lazy_widgets_sort_last(void) {
+  std::vector<uint8_t> data = shippedLayout();
+  // Swap the first (fast) and last (lazy) records
+  std::vector<uint8_t> first(record(data, 0), record(data, 1));
+  memcpy(record(data, 0), record(data, 7), LAYOUT_RECORD_BYTES);
+  memcpy(record(data, 7), first.data(), LAYOUT_RECORD_BYTES);
+  DashLayout parsed;
+  TEST_ASSERT_TRUE(layoutParse(data.data(), data.size(), parsed));
+  TEST_ASSERT_EQUAL_INT(4, parsed.fastCount);
+  for (uint8_t i = 0; i < parsed.count; i++) {
+    TEST_ASSERT_EQUAL_INT(i >= parsed.fastCount, parsed.widgets[i].flags & LAYOUT_LAZY);
+  }
+}
+
+void test_rejects_bad_files(void) {
+  const std::vector<uint8_t> good = shippedLayout();
+  std::vector<uint8_t> data;
+
+  data = good;
+  data[3] = '2';  // magic
+  TEST_ASSERT_FALSE(parses(data));
+
+  data = good;
+  data.pop_back();  // truncated
+  TEST_ASSERT_FALSE(parses(data));
+
+  data = good;
+  record(data, 1)[0] = LAYOUT_AFR;  // channel shown twice
+  TEST_ASSERT_FALSE(parses(data));
+
+  data = good;
+  record(data, 1)[4] = 400 & 0xFF;  // TPS box at x = 400 runs off the right edge
+  record(data, 1)[5] = 400 >> 8;
+  TEST_ASSERT_FALSE(parses(data));
+
+  data = good;
+  record(data, 1)[4] = 60;  // TPS box moved onto ADV
+  record(data, 1)[5] = 0;
+  TEST_ASSERT_FALSE(parses(data));
+
+  data = good;
+  record(data, 1)[6] = 221;  // TPS box down onto the status row
+  TEST_ASSERT_FALSE(parses(data));
+
+  data = good;
+  record(data, 2)[6] = 150;  // ADV box up onto the RPM readout
+  TEST_ASSERT_FALSE(parses(data));
+
+  data = good;
+  record(data, 0)[12 + LAYOUT_LABEL_LEN - 1] = 'X';  // label not terminated
+  TEST_ASSERT_FALSE(parses(data));
+
+  data = good;
+  memcpy(record(data, 0) + 12, "WWWWWWW", 8);  // 105 px label over a 100 px box
+  TEST_ASSERT_FALSE(parses(data));
+
+  data = good;
+  record(data, 0)[12] = 0xB0;  // not in the font
+  TEST_ASSERT_FALSE(parses(data));
+
+  // A failed parse leaves the table alone
+  DashLayout layout = {};
+  data = good;
+  record(data, 0)[2] = LAYOUT_COLOR_RULES;
+  TEST_ASSERT_FALSE(layoutParse(data.data(), data.size(), layout));
+  TEST_ASSERT_EQUAL_INT(0, layout.count);
+}
+
+void test_label_width_matches_font(void) {
+  spr.loadFont(AA_FONT_SMALL);
+  for (char c = ' '; c <= '~'; c++) {
+    const char last[2] = { c, '\0' }, inner[3] = { c, 'I', '\0' };
+    TEST_ASSERT_EQUAL_INT(spr.textWidth(last), layoutLabelWidth(last));
+    TEST_ASSERT_EQUAL_INT(spr.textWidth(inner), layoutLabelWidth(inner));
+  }
+  for (uint8_t i = 0; i < dashLayout.count; i++) {
+    TEST_ASSERT_EQUAL_INT(spr.textWidth(dashLayout.widgets[i].label), layoutLabelWidth(dashLayout.widgets[i].label));
+  }
+  spr.unloadFont();
+}
+
+// A label wider than its box, on a box at either edge of the screen
+void test_wide_label_tile_stays_on_screen(void) {
+  Background bg = {};
+  backgroundClear(bg, TFT_BLACK);
+  TEST_ASSERT_TRUE(backgroundAddText(bg, "WWWWWWWWWWW", 0 + 50, 5, TC_DATUM, TFT_WHITE, AA_FONT_SMALL));
+  TEST_ASSERT_TRUE(backgroundAddText(bg, "WWWWWWWWWWW", 380 + 50, 5, TC_DATUM, TFT_WHITE, AA_FONT_SMALL));
+  TEST_ASSERT_EQUAL_INT(0, bg.tiles[0].x);
+  TEST_ASSERT_EQUAL_INT(display.width(), bg.tiles[1].x + bg.tiles[1].w);
+  TEST_ASSERT_TRUE(bg.tiles[0].w > LAYOUT_BOX_W);
+
+  // Pushed where it was put, with the ink intact
+  display.fillScreen(TFT_BLACK);
+  backgroundBlitTiles(bg);
+  uint32_t ink = 0;
+  for (int16_t x = 0; x < bg.tiles[0].w; x++) ink += display.pixelAt(x, 5 + bg.tiles[0].h / 2) != TFT_BLACK;
+  TEST_ASSERT_TRUE(ink > 0);
+  backgroundClear(bg, TFT_BLACK);
+}
+
+int main(int argc, char** argv) {
+  display.init();
+  display.setRotation(3);
+  initDmaPush();
+  UNITY_BEGIN();
+  RUN_TEST(test_shipped_file_matches_builtin);
+  RUN_TEST(test_lazy_widgets_sort_last);
+  RUN_TEST(test_rejects_bad_files);
+  RUN_TEST(test_label_width_matches_font);
+  RUN_TEST(test_wide_label_tile_stays_on_screen);
+  return UNITY_END();
+}
@@ -0,0 +1,77 @@
+// Compile-time layout: the unrolled itemDraw() puts the same pixels on screen as the table walk
+//   pio test -e native -f native/test_layout_fixed
+#include <unity.h>
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <vector>
+#include "NotoSansBold15.h"
+#include "NotoSansBold36.h"
+
+#define AA_FONT_SMALL NotoSansBold15
+#define AA_FONT_LARGE NotoSansBold36
+#define LAYOUT_COMPILE_TIME
+
+TFT_eSPI display = TFT_eSPI();
+TFT_eSprite spr = TFT_eSprite(&display);
+
+#include "dma_push.h"
+#include "render_bench.h"
+
+static std::vector<uint16_t> grabScreen() {
+  std::vector<uint16_t> px;
+  for (int32_t y = 0; y < display.height(); y++)
+    for (int32_t x = 0; x < display.width(); x++) px.push_back(display.pixelAt(x, y));
+  return px;
+}
+
+static void setEngine(int afr, int throttle, int advance, int map, uint8_t intake, uint8_t coolant, int volts) {
+  afrConv = Tenths::fromRaw(afr);
+  tps = throttle;
+  adv = advance;
+  mapData = map;
+  iat = intake;
+  clt = coolant;
+  bat = Tenths::fromRaw(volts);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_unrolled_matches_table(void) {
+  // Rich, lean and normal AFR, hot coolant and low voltage exercise every colour rule
+  const int afrs[] = { 118, 160, 147 };
+  const uint8_t coolants[] = { 80, 105, 90 };
+  const int volts[] = { 138, 110, 150 };
+  for (uint8_t i = 0; i < 3; i++) {
+    setEngine(afrs[i], 20 + i * 30, 10 + i, 40 + i * 60, 30 + i, coolants[i], volts[i]);
+    itemDraw(true);
+    dmaPushFlush();
+    std::vector<uint16_t> unrolled = grabScreen();
+
+    drawWidgets(dashLayout.widgets, dashLayout.widgets + dashLayout.count, true);
+    dmaPushFlush();
+    TEST_ASSERT_TRUE(unrolled == grabScreen());
+  }
+}
+
+void test_unrolled_skips_unchanged(void) {
+  itemDraw(true);
+  dmaPushFlush();
+  display.resetStats();
+  itemDraw(false);
+  dmaPushFlush();
+  TEST_ASSERT_EQUAL_UINT32(0, (uint32_t)display.stats.spiBytes);
+}
+
+int main(int argc, char** argv) {
+  display.init();
+  display.setRotation(3);
+  initDmaPush();
+  EEPROM.begin(512);
+  benchIdleState();
+  startUpDisplay();
+  UNITY_BEGIN();
+  RUN_TEST(test_unrolled_matches_table);
+  RUN_TEST(test_unrolled_skips_unchanged);
+  return UNITY_END();
+}
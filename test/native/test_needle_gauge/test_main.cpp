@@ -0,0 +1,104 @@
+// Needle gauge: fixed-point trig, incremental needle updates and their cost
+//   pio test -e native -f native/test_needle_gauge -v
+#include <unity.h>
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <math.h>
+#include "NotoSansBold15.h"
+
+TFT_eSPI display = TFT_eSPI();
+
+#include "dma_push.h"
+#include "needle_gauge.h"
+
+// 0..8000 rpm over 270 degrees, labels in thousands
+const NeedleGaugeStyle tachStyle = { 0, 8000, 1000, 4, 1000, -384, 768, TFT_WHITE, TFT_RED };
+static NeedleGauge tach;
+
+#define DIAL_X 140
+#define DIAL_Y 60
+#define DIAL_SIZE 200
+
+// Screen position `radius` px out along the needle for `value`
+static void needlePoint(int32_t value, int32_t radius, int32_t& x, int32_t& y) {
+  double a = (tachStyle.startAngle + (double)tachStyle.sweep * value / tachStyle.maxValue) * 2 * M_PI / TRIG_TURN;
+  x = DIAL_X + DIAL_SIZE / 2 + (int32_t)lround(sin(a) * radius);
+  y = DIAL_Y + DIAL_SIZE / 2 - (int32_t)lround(cos(a) * radius);
+}
+
+void setUp(void) {
+  display.fillScreen(TFT_BLACK);
+  display.resetStats();
+}
+
+void tearDown(void) {}
+
+void test_trig_table(void) {
+  for (int32_t a = -TRIG_TURN; a <= TRIG_TURN; a++) {
+    double ref = sin(a * 2 * M_PI / TRIG_TURN) * TRIG_ONE;
+    TEST_ASSERT_TRUE(fabs(isin(a) - ref) <= 1.0);
+    TEST_ASSERT_TRUE(fabs(icos(a) - cos(a * 2 * M_PI / TRIG_TURN) * TRIG_ONE) <= 1.0);
+  }
+  TEST_ASSERT_EQUAL_UINT32(255, isqrt32(65535));
+  TEST_ASSERT_EQUAL_UINT32(256, isqrt32(65536));
+}
+
+void test_needle_follows_value(void) {
+  needleGaugeDraw(tach, 2000);
+  dmaPushFlush();
+  int32_t x, y;
+  needlePoint(2000, 60, x, y);
+  TEST_ASSERT_EQUAL_HEX16(TFT_RED, display.pixelAt(x, y));
+
+  needleGaugeSet(tach, 6000);
+  dmaPushFlush();
+  TEST_ASSERT_NOT_EQUAL(TFT_RED, display.pixelAt(x, y));  // old needle erased
+  needlePoint(6000, 60, x, y);
+  TEST_ASSERT_EQUAL_HEX16(TFT_RED, display.pixelAt(x, y));
+}
+
+void test_small_move_costs_a_strip(void) {
+  needleGaugeDraw(tach, 3000);
+  dmaPushFlush();
+  uint64_t full = display.stats.spiBytes;
+  TEST_ASSERT_EQUAL_UINT32(DIAL_SIZE * DIAL_SIZE * 3 + HOST_WINDOW_BYTES, full);
+
+  // A 60 Hz sweep across the whole scale in one second
+  display.resetStats();
+  uint32_t updates = 0;
+  for (int32_t v = 3000; v <= 8000; v += 8000 / 60) updates += needleGaugeSet(tach, v);
+  for (int32_t v = 8000; v >= 0; v -= 8000 / 60) updates += needleGaugeSet(tach, v);
+  dmaPushFlush();
+  uint32_t perUpdate = display.stats.spiBytes / updates;
+  TEST_ASSERT_TRUE(perUpdate * 4 < full);
+
+  char msg[128];
+  snprintf(msg, sizeof(msg), "full dial %lu B, needle update %lu B avg -> %lu updates/s at %d MHz SPI",
+           (unsigned long)full, (unsigned long)perUpdate, (unsigned long)(1000000UL / dmaWireTimeUs(perUpdate)),
+           SPI_FREQUENCY / 1000000);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_TRUE(1000000UL / dmaWireTimeUs(perUpdate) >= 60);
+}
+
+void test_unchanged_value_pushes_nothing(void) {
+  needleGaugeDraw(tach, 1500);
+  dmaPushFlush();
+  display.resetStats();
+  TEST_ASSERT_FALSE(needleGaugeSet(tach, 1500));
+  TEST_ASSERT_EQUAL_UINT32(0, display.stats.spiBytes);
+}
+
+int main(int argc, char** argv) {
+  display.init();
+  display.setRotation(3);
+  initDmaPush();
+  needleGaugeBegin(tach, tachStyle, DIAL_X, DIAL_Y, DIAL_SIZE, NotoSansBold15);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_trig_table);
+  RUN_TEST(test_needle_follows_value);
+  RUN_TEST(test_small_move_costs_a_strip);
+  RUN_TEST(test_unchanged_value_pushes_nothing);
+  if (getenv("NEEDLE_PPM")) display.savePPM(getenv("NEEDLE_PPM"));
+  return UNITY_END();
+}
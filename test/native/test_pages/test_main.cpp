@@ -0,0 +1,99 @@
+// Pages: switch cost and that every page paints out exactly what it drew
+//   pio test -e native -f native/test_pages -v
+#include <unity.h>
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <vector>
+#include "NotoSansBold15.h"
+#include "NotoSansBold36.h"
+
+#define AA_FONT_SMALL NotoSansBold15
+#define AA_FONT_LARGE NotoSansBold36
+
+TFT_eSPI display = TFT_eSPI();
+TFT_eSprite spr = TFT_eSprite(&display);
+
+#include "dma_push.h"
+#include "render_bench.h"
+
+static void benchPrint(const char* line) { TEST_MESSAGE(line); }
+
+static std::vector<uint16_t> grabScreen() {
+  std::vector<uint16_t> px;
+  for (int32_t y = 0; y < display.height(); y++)
+    for (int32_t x = 0; x < display.width(); x++) px.push_back(display.pixelAt(x, y));
+  return px;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_switches_fit_100ms(void) {
+  runBenchPages(benchPrint);
+  for (uint8_t from = 0; from < PAGE_COUNT; from++) {
+    for (uint8_t to = 0; to < PAGE_COUNT; to++) {
+      if (from == to) continue;
+      pageShow((PageId)from);
+      drawPage();
+      for (uint16_t i = 0; from == PAGE_TREND && i < TREND_PLOT_W; i++) {
+        int16_t values[TREND_CHANNELS] = { (int16_t)(2500 + (i * 37) % 800), 60, 147, 18 };
+        trendPageSample(trendPage, values);
+      }
+      dmaPushFlush();
+      resetRenderProfile();
+      TEST_ASSERT_TRUE(pageShow((PageId)to));
+      TEST_ASSERT_LESS_THAN(100000, (int)dmaWireTimeUs(renderProfile[PROF_PAGE_SWITCH].bytes));
+    }
+  }
+  pageShow(PAGE_MAIN);
+}
+
+// Leaving a page must leave nothing behind: main -> page -> main is pixel identical
+void test_round_trip_restores_main(void) {
+  pageShow(PAGE_MAIN);
+  drawPage();
+  dmaPushFlush();
+  std::vector<uint16_t> before = grabScreen();
+  for (uint8_t p = PAGE_TEMPS; p < PAGE_COUNT; p++) {
+    TEST_ASSERT_TRUE(pageShow((PageId)p));
+    drawPage();
+    TEST_ASSERT_TRUE(pageShow(PAGE_MAIN));
+    dmaPushFlush();
+    TEST_ASSERT_TRUE(before == grabScreen());
+  }
+}
+
+// Only the active page draws, and a settled page pushes nothing
+void test_settled_page_pushes_nothing(void) {
+  for (uint8_t p = PAGE_MAIN; p < PAGE_DIAG; p++) {
+    pageShow((PageId)p);
+    drawPage();
+    dmaPushFlush();
+    display.resetStats();
+    drawPage();
+    dmaPushFlush();
+    TEST_ASSERT_EQUAL_UINT32(0, display.stats.spiBytes);
+  }
+  pageShow(PAGE_MAIN);
+}
+
+void test_page_names(void) {
+  TEST_ASSERT_EQUAL_INT(PAGE_FUEL, pageByName("fuel"));
+  TEST_ASSERT_EQUAL_INT(PAGE_COUNT, pageByName("nope"));
+}
+
+int main(int argc, char** argv) {
+  (void)argc;
+  (void)argv;
+  display.setRotation(3);
+  initDmaPush();
+  EEPROM.begin(512);
+  benchIdleState();
+  startUpDisplay();
+  UNITY_BEGIN();
+  RUN_TEST(test_switches_fit_100ms);
+  RUN_TEST(test_round_trip_restores_main);
+  RUN_TEST(test_settled_page_pushes_nothing);
+  RUN_TEST(test_page_names);
+  return UNITY_END();
+}
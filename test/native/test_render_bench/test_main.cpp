@@ -0,0 +1,75 @@
+// Render benchmark: per-widget time, pixels and SPI bytes per frame for the
+// scripted dashboard scenarios, against the host display backend.
+//   pio test -e native -f native/test_render_bench -v
+// Set RENDER_BENCH_PPM=<dir> to also dump the last frame of each scenario.
+#include <unity.h>
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <stdlib.h>
+#include "NotoSansBold15.h"
+#include "NotoSansBold36.h"
+
+#define AA_FONT_SMALL NotoSansBold15
+#define AA_FONT_LARGE NotoSansBold36
+
+TFT_eSPI display = TFT_eSPI();
+TFT_eSprite spr = TFT_eSprite(&display);
+
+#include "dma_push.h"
+#include "render_bench.h"
+
+static void benchPrint(const char* line) { TEST_MESSAGE(line); }
+
+static void dumpFrame(const char* name) {
+  const char* dir = getenv("RENDER_BENCH_PPM");
+  if (!dir) return;
+  char path[256];
+  snprintf(path, sizeof(path), "%s/%s.ppm", dir, name);
+  for (char* p = path + strlen(dir) + 1; *p; p++) if (*p == ' ') *p = '_';
+  display.savePPM(path);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_splash(void) {
+  BenchResult r = runBenchSplash(benchPrint);
+  TEST_ASSERT_EQUAL_UINT32(SPLASH_CUSTOM, r.frames);
+  TEST_ASSERT_GREATER_THAN(0, (int)(r.pixels / r.frames));
+}
+
+void test_scenarios(void) {
+  startUpDisplay();
+  dumpFrame("startup");
+  for (const BenchScenario& s : benchScenarios) {
+    BenchResult r = runBenchScenario(s, benchPrint);
+    TEST_ASSERT_EQUAL_UINT32(s.frames, r.frames);
+
+    // Widgets nest inside the frame scope, so they can never add up to more
+    uint64_t widgetBytes = 0;
+    for (uint8_t i = PROF_RPM_BAR; i <= PROF_BUTTON; i++) widgetBytes += renderProfile[i].bytes;
+    TEST_ASSERT_TRUE(widgetBytes <= r.bytes);
+    dumpFrame(s.name);
+  }
+}
+
+void test_sweep_redraws_rpm_every_frame(void) {
+  const BenchScenario& sweep = benchScenarios[2];
+  runBenchScenario(sweep, nullptr);
+  TEST_ASSERT_EQUAL_UINT32(sweep.frames, renderProfile[PROF_RPM_VALUE].calls);
+  TEST_ASSERT_EQUAL_UINT32(sweep.frames, renderProfile[PROF_RPM_BAR].calls);
+}
+
+int main(int argc, char** argv) {
+  display.init();
+  display.setRotation(3);
+  initDmaPush();
+  EEPROM.begin(512);
+  EEPROM.write(0, 1);  // FPS mode
+
+  UNITY_BEGIN();
+  RUN_TEST(test_splash);
+  RUN_TEST(test_scenarios);
+  RUN_TEST(test_sweep_redraws_rpm_every_frame);
+  return UNITY_END();
+}
@@ -0,0 +1,63 @@
+// Word RLE used for the compressed background layer
+//   pio test -e native -f native/test_rle
+#include <unity.h>
+#include <vector>
+#include "rle.h"
+
+static std::vector<uint8_t> roundTrip(const std::vector<uint16_t>& src, size_t& words, int32_t chunk) {
+  words = rleEncode16(src.data(), src.size(), nullptr, 0);
+  std::vector<uint16_t> packed(words);
+  TEST_ASSERT_EQUAL_UINT32(words, rleEncode16(src.data(), src.size(), packed.data(), words));
+
+  // Decode in uneven pieces, like DMA chunks cutting through tokens
+  std::vector<uint8_t> out(src.size() * 3);
+  RleReader reader;
+  rleBegin(reader, packed.data());
+  for (size_t at = 0; at < src.size(); at += chunk) {
+    int32_t n = (int32_t)((src.size() - at < (size_t)chunk) ? src.size() - at : chunk);
+    rleDecodeRgb666(reader, out.data() + at * 3, n);
+  }
+  return out;
+}
+
+static void checkRoundTrip(const std::vector<uint16_t>& src, size_t& words) {
+  std::vector<uint8_t> expected(src.size() * 3);
+  rgb565ToRgb666Run(src.data(), expected.data(), src.size());
+  for (int32_t chunk : { 1, 7, 480 }) {
+    std::vector<uint8_t> out = roundTrip(src, words, chunk);
+    TEST_ASSERT_EQUAL_MEMORY(expected.data(), out.data(), expected.size());
+  }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_solid_row_is_one_run(void) {
+  std::vector<uint16_t> src(480, 0x1234);
+  size_t words;
+  checkRoundTrip(src, words);
+  TEST_ASSERT_EQUAL_UINT32(2, words);
+}
+
+void test_mixed_runs_and_literals(void) {
+  std::vector<uint16_t> src;
+  for (int i = 0; i < 2000; i++) src.push_back((i % 37 < 20) ? 0 : (uint16_t)(i * 2654435761u >> 16));
+  src.push_back(5);  // single-pixel tail
+  size_t words;
+  checkRoundTrip(src, words);
+  TEST_ASSERT_TRUE(words < src.size());
+}
+
+void test_encode_reports_overflow(void) {
+  std::vector<uint16_t> src = { 1, 2, 3, 4 };
+  uint16_t dst[3];
+  TEST_ASSERT_EQUAL_UINT32(0, rleEncode16(src.data(), src.size(), dst, 3));
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_solid_row_is_one_run);
+  RUN_TEST(test_mixed_runs_and_literals);
+  RUN_TEST(test_encode_reports_overflow);
+  return UNITY_END();
+}
@@ -0,0 +1,61 @@
+// RPM prediction between ECU samples
+//   pio test -e native -f native/test_rpm_interpolator
+#include <unity.h>
+#include "rpm_interpolator.h"
+
+static RpmInterpolator interp;
+
+void setUp(void) { rpmInterpolatorReset(interp); }
+void tearDown(void) {}
+
+void test_single_sample_holds(void) {
+  rpmInterpolatorAdd(interp, 900, 0);
+  TEST_ASSERT_EQUAL_INT32(900, rpmInterpolatorAt(interp, 30));
+}
+
+void test_ramp_is_extrapolated_between_samples(void) {
+  // +100 rpm every 40 ms
+  rpmInterpolatorAdd(interp, 3000, 0);
+  rpmInterpolatorAdd(interp, 3100, 40);
+  rpmInterpolatorAdd(interp, 3200, 80);
+  TEST_ASSERT_EQUAL_INT32(3200, rpmInterpolatorAt(interp, 80));
+  TEST_ASSERT_EQUAL_INT32(3250, rpmInterpolatorAt(interp, 100));
+  TEST_ASSERT_EQUAL_INT32(3300, rpmInterpolatorAt(interp, 120));
+}
+
+void test_prediction_stops_after_one_period(void) {
+  rpmInterpolatorAdd(interp, 3000, 0);
+  rpmInterpolatorAdd(interp, 3100, 40);
+  TEST_ASSERT_EQUAL_INT32(3200, rpmInterpolatorAt(interp, 500));
+}
+
+void test_sudden_drop_snaps(void) {
+  rpmInterpolatorAdd(interp, 6000, 0);
+  rpmInterpolatorAdd(interp, 6500, 40);
+  rpmInterpolatorAdd(interp, 2000, 80);  // rev cut / clutch
+  TEST_ASSERT_EQUAL_INT32(2000, rpmInterpolatorAt(interp, 80));
+  TEST_ASSERT_EQUAL_INT32(2000, rpmInterpolatorAt(interp, 110));
+}
+
+void test_stale_history_is_dropped(void) {
+  rpmInterpolatorAdd(interp, 1000, 0);
+  rpmInterpolatorAdd(interp, 3000, 1000);  // link was down for a second
+  TEST_ASSERT_EQUAL_INT32(3000, rpmInterpolatorAt(interp, 1020));
+}
+
+void test_never_negative(void) {
+  rpmInterpolatorAdd(interp, 300, 0);
+  rpmInterpolatorAdd(interp, 100, 100);
+  TEST_ASSERT_EQUAL_INT32(0, rpmInterpolatorAt(interp, 200));
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_single_sample_holds);
+  RUN_TEST(test_ramp_is_extrapolated_between_samples);
+  RUN_TEST(test_prediction_stops_after_one_period);
+  RUN_TEST(test_sudden_drop_snaps);
+  RUN_TEST(test_stale_history_is_dropped);
+  RUN_TEST(test_never_negative);
+  return UNITY_END();
+}
@@ -0,0 +1,135 @@
+// Splash pack and blit: every path lands the same pixels as the source images, in one window
+//   pio test -e native -f native/test_splash_blit
+#include <unity.h>
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <stdio.h>
+#include <vector>
+
+TFT_eSPI display = TFT_eSPI();
+TFT_eSprite spr = TFT_eSprite(&display);
+
+#include "dma_push.h"
+#include "splash/splash_manager.h"
+
+#define SPLASH_WIDTH 480
+#define SPLASH_HEIGHT 320
+
+// The PBM the pack was built from, rows only
+static std::vector<uint8_t> sourceBitmap(SplashType type) {
+  static const char* const files[SPLASH_CUSTOM] = { "zettech", "mazduino", "speeduino" };
+  char path[64];
+  snprintf(path, sizeof(path), "tools/splash/%s.pbm", files[type]);
+  std::vector<uint8_t> data(SPLASH_WIDTH / 8 * SPLASH_HEIGHT);
+  FILE* f = fopen(path, "rb");
+  TEST_ASSERT_TRUE(f != nullptr);
+  char header[16];
+  TEST_ASSERT_TRUE(fgets(header, sizeof(header), f) && fgets(header, sizeof(header), f));  // "P4", "480 320"
+  TEST_ASSERT_EQUAL_UINT32(data.size(), fread(data.data(), 1, data.size(), f));
+  fclose(f);
+  return data;
+}
+
+static void checkBitmap(TFT_eSPI& tft, SplashType type, uint16_t fg, uint16_t bg) {
+  std::vector<uint8_t> bitmap = sourceBitmap(type);
+  for (int32_t y = 0; y < SPLASH_HEIGHT; y++) {
+    for (int32_t x = 0; x < SPLASH_WIDTH; x++) {
+      bool set = (bitmap[y * (SPLASH_WIDTH / 8) + x / 8] << (x & 7)) & 0x80;
+      if (tft.pixelAt(x, y) != (set ? fg : bg)) {
+        char msg[64];
+        snprintf(msg, sizeof(msg), "pixel (%d, %d)", (int)x, (int)y);
+        TEST_FAIL_MESSAGE(msg);
+        return;
+      }
+    }
+  }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Each stream decodes to its source image, well under the unpacked size
+void test_pack_decodes(void) {
+  uint32_t packed = 0;
+  for (uint8_t i = 0; i < SPLASH_CUSTOM; i++) {
+    SplashAsset asset = {};
+    TEST_ASSERT_TRUE(getSplashAsset((SplashType)i, asset));
+    TEST_ASSERT_EQUAL_INT(SPLASH_WIDTH, asset.width);
+    TEST_ASSERT_EQUAL_INT(SPLASH_HEIGHT, asset.height);
+    std::vector<uint8_t> bits(asset.width / 8 * asset.height);
+    SplashRunReader runs;
+    runs.begin(asset);
+    for (uint32_t p = 0; p < bits.size() * 8; p++) bits[p / 8] |= runs.pixel() << (7 - (p & 7));
+    TEST_ASSERT_TRUE(bits == sourceBitmap((SplashType)i));
+    packed += asset.length;
+  }
+  TEST_ASSERT_EQUAL_STRING("Mazduino ECU", getSplashScreenName(SPLASH_MAZDUINO));
+  TEST_ASSERT_TRUE(sizeof(splashPack) < SPLASH_CUSTOM * SPLASH_WIDTH / 8 * SPLASH_HEIGHT / 4);
+  TEST_ASSERT_TRUE(packed < sizeof(splashPack));
+}
+
+// A damaged pack is refused, and a stream cut short reads as clear pixels
+void test_pack_rejects_bad_data(void) {
+  std::vector<uint8_t> pack(splashPack, splashPack + sizeof(splashPack));
+  SplashAsset asset = {};
+  pack[3] = '2';
+  TEST_ASSERT_FALSE(splashPackEntry(pack.data(), pack.size(), 0, asset));
+  pack[3] = '1';
+  TEST_ASSERT_FALSE(splashPackEntry(pack.data(), pack.size(), SPLASH_CUSTOM, asset));
+  TEST_ASSERT_FALSE(splashPackEntry(pack.data(), pack.size() - 1, SPLASH_CUSTOM - 1, asset));  // last stream runs past the end
+  TEST_ASSERT_TRUE(splashPackEntry(pack.data(), pack.size(), 0, asset));
+
+  asset.length = 1;  // the first clear run only
+  SplashRunReader runs;
+  runs.begin(asset);
+  for (uint32_t p = 0; p < (uint32_t)SPLASH_WIDTH * SPLASH_HEIGHT; p++) TEST_ASSERT_EQUAL_INT(0, runs.pixel());
+}
+
+// White on black: the 3-bit interface format, two pixels per byte
+void test_primary_colors_go_3bit(void) {
+  for (uint8_t i = 0; i < SPLASH_CUSTOM; i++) {
+    display.fillScreen(TFT_DARKGREY);
+    display.resetStats();
+    drawSplash(display, (SplashType)i, 0, 0, TFT_WHITE, TFT_BLACK);
+    checkBitmap(display, (SplashType)i, TFT_WHITE, TFT_BLACK);
+    TEST_ASSERT_EQUAL_UINT32(1, display.stats.windows);
+    TEST_ASSERT_TRUE(display.stats.spiBytes < SPLASH_WIDTH * SPLASH_HEIGHT / 2 + 64);
+  }
+  // Back in RGB666 afterwards
+  display.fillRect(0, 0, 4, 1, TFT_ORANGE);
+  TEST_ASSERT_EQUAL_HEX16(TFT_ORANGE, display.pixelAt(3, 0));
+}
+
+// Anything else goes out as RGB666 from the nibble table
+void test_other_colors_go_rgb666(void) {
+  display.resetStats();
+  drawSplash(display, SPLASH_MAZDUINO, 0, 0, TFT_ORANGE, TFT_NAVY);
+  checkBitmap(display, SPLASH_MAZDUINO, TFT_ORANGE, TFT_NAVY);
+  TEST_ASSERT_EQUAL_UINT32(1, display.stats.windows);
+  TEST_ASSERT_TRUE(display.stats.spiBytes < SPLASH_WIDTH * SPLASH_HEIGHT * 3 + 64);
+}
+
+// Another display has no DMA buffers: one pushImage() per scanline
+void test_other_display_falls_back(void) {
+  TFT_eSPI other;
+  other.init();
+  other.setRotation(3);
+  other.resetStats();
+  drawSplash(other, SPLASH_SPEEDUINO, 0, 0, TFT_WHITE, TFT_BLACK);
+  checkBitmap(other, SPLASH_SPEEDUINO, TFT_WHITE, TFT_BLACK);
+  TEST_ASSERT_EQUAL_UINT32(SPLASH_HEIGHT, other.stats.windows);
+}
+
+int main(int argc, char** argv) {
+  display.init();
+  display.setRotation(3);
+  initDmaPush();
+  EEPROM.begin(512);
+  UNITY_BEGIN();
+  RUN_TEST(test_pack_decodes);
+  RUN_TEST(test_pack_rejects_bad_data);
+  RUN_TEST(test_primary_colors_go_3bit);
+  RUN_TEST(test_other_colors_go_rgb666);
+  RUN_TEST(test_other_display_falls_back);
+  return UNITY_END();
+}
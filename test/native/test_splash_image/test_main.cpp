@@ -0,0 +1,165 @@
+// Colour splash BMPs: streamed straight to the panel, refused when they can't be shown
+//   pio test -e native -f native/test_splash_image
+#include <unity.h>
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <stdio.h>
+#include <vector>
+
+TFT_eSPI display = TFT_eSPI();
+TFT_eSprite spr = TFT_eSprite(&display);
+
+#include "dma_push.h"
+#include "splash/splash_manager.h"
+#include "splash/splash_image.h"
+
+struct MemoryReader {
+  const std::vector<uint8_t>* data;
+  uint32_t pos;
+  uint32_t chunk;  // most bytes handed out per read, like a file system would
+};
+
+static uint32_t memoryRead(uint8_t* dst, uint32_t len, void* ctx) {
+  MemoryReader* r = (MemoryReader*)ctx;
+  uint32_t n = std::min(std::min(len, r->chunk), (uint32_t)r->data->size() - r->pos);
+  memcpy(dst, r->data->data() + r->pos, n);
+  r->pos += n;
+  return n;
+}
+
+static bool drawBmp(const std::vector<uint8_t>& data, uint16_t bg = TFT_BLACK) {
+  MemoryReader reader = { &data, 0, 512 };
+  return splashDrawBmp(display, memoryRead, &reader, bg);
+}
+
+static uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b) { return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3); }
+
+static void putU32(std::vector<uint8_t>& v, uint32_t at, uint32_t value) {
+  for (uint8_t i = 0; i < 4; i++) v[at + i] = (uint8_t)(value >> (i * 8));
+}
+
+// 24-bit BMP with a pattern that tells rows and channels apart
+static std::vector<uint8_t> makeBmp24(int32_t w, int32_t h, bool topDown) {
+  uint32_t stride = (w * 3 + 3) & ~3;
+  std::vector<uint8_t> v(BMP_HEADER_BYTES + stride * h);
+  v[0] = 'B';
+  v[1] = 'M';
+  putU32(v, 2, v.size());
+  putU32(v, 10, BMP_HEADER_BYTES);
+  putU32(v, 14, 40);
+  putU32(v, 18, w);
+  putU32(v, 22, topDown ? -h : h);
+  v[26] = 1;
+  v[28] = 24;
+  for (int32_t y = 0; y < h; y++) {
+    uint8_t* row = v.data() + BMP_HEADER_BYTES + (topDown ? y : h - 1 - y) * stride;
+    for (int32_t x = 0; x < w; x++) {
+      row[x * 3] = (uint8_t)(x * 5);      // blue
+      row[x * 3 + 1] = (uint8_t)(y * 4);  // green
+      row[x * 3 + 2] = (uint8_t)(x + y);  // red
+    }
+  }
+  return v;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// The shipped 8-bit speeduino.bmp, through its palette, every pixel
+void test_paletted_full_screen(void) {
+  std::vector<uint8_t> data(200000);
+  FILE* f = fopen("data/speeduino.bmp", "rb");
+  TEST_ASSERT_TRUE(f != nullptr);
+  data.resize(fread(data.data(), 1, data.size(), f));
+  fclose(f);
+
+  display.fillScreen(TFT_RED);
+  display.resetStats();
+  TEST_ASSERT_TRUE(drawBmp(data));
+  BmpInfo info;
+  TEST_ASSERT_TRUE(bmpParseHeader(data.data(), info));
+  TEST_ASSERT_EQUAL_INT(8, info.bpp);
+  for (int32_t y = 0; y < 320; y++) {
+    const uint8_t* row = data.data() + info.dataOffset + (info.topDown ? y : 319 - y) * 480;
+    for (int32_t x = 0; x < 480; x++) {
+      const uint8_t* bgrx = data.data() + info.paletteOffset + row[x] * 4;
+      if (display.pixelAt(x, y) != rgb565(bgrx[2], bgrx[1], bgrx[0])) {
+        char msg[64];
+        snprintf(msg, sizeof(msg), "pixel (%d, %d)", (int)x, (int)y);
+        TEST_FAIL_MESSAGE(msg);
+        return;
+      }
+    }
+  }
+  // No clear underneath, and only the window commands on top of the RGB666 pixels
+  TEST_ASSERT_EQUAL_UINT32(480 * 320, display.stats.pixels);
+  TEST_ASSERT_TRUE(display.stats.spiBytes < 480 * 320 * 3 + 320 * 16);
+}
+
+// A smaller image is centred, with the rest of the screen cleared
+void test_small_image_centred(void) {
+  for (uint8_t topDown = 0; topDown < 2; topDown++) {
+    std::vector<uint8_t> data = makeBmp24(101, 50, topDown);
+    display.fillScreen(TFT_RED);
+    TEST_ASSERT_TRUE(drawBmp(data, TFT_NAVY));
+    int32_t x0 = (480 - 101) / 2, y0 = (320 - 50) / 2;
+    TEST_ASSERT_EQUAL_HEX16(TFT_NAVY, display.pixelAt(0, 0));
+    TEST_ASSERT_EQUAL_HEX16(TFT_NAVY, display.pixelAt(x0 - 1, y0));
+    TEST_ASSERT_EQUAL_HEX16(TFT_NAVY, display.pixelAt(x0 + 101, y0 + 49));
+    for (int32_t y = 0; y < 50; y++) {
+      for (int32_t x = 0; x < 101; x++) {
+        TEST_ASSERT_EQUAL_HEX16(rgb565(x + y, y * 4, x * 5), display.pixelAt(x0 + x, y0 + y));
+      }
+    }
+  }
+}
+
+void test_rejects_what_it_cannot_show(void) {
+  std::vector<uint8_t> good = makeBmp24(16, 16, false), data;
+  BmpInfo info;
+
+  data = good;
+  data[28] = 16;  // 16-bit
+  TEST_ASSERT_FALSE(bmpParseHeader(data.data(), info));
+
+  data = good;
+  data[30] = 1;  // RLE8
+  TEST_ASSERT_FALSE(bmpParseHeader(data.data(), info));
+
+  data = good;
+  putU32(data, 18, 481);  // wider than the screen
+  TEST_ASSERT_FALSE(bmpParseHeader(data.data(), info));
+
+  // Cut short: drawn as far as it goes, then reported
+  data = good;
+  data.resize(data.size() - 20);
+  TEST_ASSERT_FALSE(drawBmp(data));
+  TEST_ASSERT_TRUE(drawBmp(good));
+}
+
+// No file system on the host: the custom entry is skipped and falls back to a logo
+void test_custom_falls_back_to_logo(void) {
+  setSplashScreen(SPLASH_SPEEDUINO);
+  TEST_ASSERT_EQUAL_INT(SPLASH_ZETTECH, nextSplashScreen());
+
+  drawSplash(display, SPLASH_ZETTECH);
+  std::vector<uint16_t> logo(480 * 320);
+  for (int32_t i = 0; i < 480 * 320; i++) logo[i] = display.pixelAt(i % 480, i / 480);
+  display.fillScreen(TFT_RED);
+  drawSplash(display, SPLASH_CUSTOM);
+  for (int32_t i = 0; i < 480 * 320; i += 97) TEST_ASSERT_EQUAL_HEX16(logo[i], display.pixelAt(i % 480, i / 480));
+  TEST_ASSERT_EQUAL_STRING("Custom image", getSplashScreenName(SPLASH_CUSTOM));
+}
+
+int main(int argc, char** argv) {
+  display.init();
+  display.setRotation(3);
+  initDmaPush();
+  EEPROM.begin(512);
+  UNITY_BEGIN();
+  RUN_TEST(test_paletted_full_screen);
+  RUN_TEST(test_small_image_centred);
+  RUN_TEST(test_rejects_what_it_cannot_show);
+  RUN_TEST(test_custom_falls_back_to_logo);
+  return UNITY_END();
+}
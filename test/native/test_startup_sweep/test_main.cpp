@@ -0,0 +1,68 @@
+// Start-up sweep: fixed length and frame rate whatever a frame costs
+//   pio test -e native -f native/test_startup_sweep
+#include <unity.h>
+#include "startup_sweep.h"
+
+// Run a sweep whose frames take `frameCostMs` to draw; returns when it ended
+static uint32_t runSweep(StartupSweep& sweep, uint32_t frameCostMs, int32_t* lastRpm) {
+  uint32_t now = 5000;
+  sweepBegin(sweep, 6000, now);
+  int32_t previous = 6001;
+  for (uint32_t guard = 0; guard < 10000 && !sweep.done; guard++) {
+    if (sweepFrameDue(sweep, now)) {
+      int32_t value = sweepRpmAt(sweep, now);
+      TEST_ASSERT_TRUE(value < previous);  // always moving down
+      previous = value;
+      now += frameCostMs;
+      sweepFrameDrawn(sweep, now - frameCostMs);
+    } else {
+      now += sweepSpareMs(sweep, now);  // the caller's own work fills the gap
+    }
+  }
+  *lastRpm = previous;
+  return now - 5000;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Cheap frames: one every SWEEP_FRAME_MS, ending on 0 at SWEEP_DURATION_MS
+void test_fixed_rate(void) {
+  StartupSweep sweep;
+  int32_t last;
+  uint32_t took = runSweep(sweep, 5, &last);
+  TEST_ASSERT_EQUAL_INT(0, last);
+  TEST_ASSERT_EQUAL_UINT32(SWEEP_DURATION_MS + 5, took);
+  TEST_ASSERT_EQUAL_INT(SWEEP_DURATION_MS / SWEEP_FRAME_MS + 2, sweep.frames);
+}
+
+// Frames slower than the frame time drop frames instead of stretching the sweep
+void test_slow_frames_keep_the_length(void) {
+  StartupSweep sweep;
+  int32_t last;
+  uint32_t took = runSweep(sweep, 50, &last);
+  TEST_ASSERT_EQUAL_INT(0, last);
+  TEST_ASSERT_TRUE(took <= SWEEP_DURATION_MS + 50 + SWEEP_FRAME_MS);
+  TEST_ASSERT_TRUE(sweep.frames < SWEEP_DURATION_MS / SWEEP_FRAME_MS);
+}
+
+// The value follows the clock, and the gap to the next frame is there to use
+void test_value_and_spare_time(void) {
+  StartupSweep sweep;
+  sweepBegin(sweep, 6000, 0);
+  TEST_ASSERT_EQUAL_INT(6000, sweepRpmAt(sweep, 0));
+  TEST_ASSERT_EQUAL_INT(3000, sweepRpmAt(sweep, SWEEP_DURATION_MS / 2));
+  TEST_ASSERT_EQUAL_INT(0, sweepRpmAt(sweep, SWEEP_DURATION_MS + 100));
+  TEST_ASSERT_EQUAL_UINT32(0, sweepSpareMs(sweep, 0));
+  sweepFrameDrawn(sweep, 0);
+  TEST_ASSERT_FALSE(sweepFrameDue(sweep, 8));
+  TEST_ASSERT_EQUAL_UINT32(SWEEP_FRAME_MS - 8, sweepSpareMs(sweep, 8));
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_fixed_rate);
+  RUN_TEST(test_slow_frames_keep_the_length);
+  RUN_TEST(test_value_and_spare_time);
+  return UNITY_END();
+}
@@ -0,0 +1,100 @@
+// Strip chart: ring history, circular-sprite scrolling and its cost
+//   pio test -e native -f native/test_strip_chart
+#include <unity.h>
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <vector>
+
+TFT_eSPI display = TFT_eSPI();
+
+#include "dma_push.h"
+#include "strip_chart.h"
+
+#define CHART_W 200
+#define CHART_H 60
+
+static ChartRing ring;
+
+static std::vector<uint16_t> grab(int32_t x, int32_t y, int32_t w, int32_t h) {
+  std::vector<uint16_t> px;
+  for (int32_t j = y; j < y + h; j++)
+    for (int32_t i = x; i < x + w; i++) px.push_back(display.pixelAt(i, j));
+  return px;
+}
+
+static int16_t sample(uint32_t i) { return 100 + (int16_t)((i * 37) % 61) - 30; }
+
+void setUp(void) {
+  free(ring.samples);
+  chartRingBegin(ring, 256);
+  display.fillScreen(TFT_BLACK);
+}
+
+void tearDown(void) {}
+
+void test_ring_wraps(void) {
+  ChartRing small;
+  chartRingBegin(small, 4);
+  for (int16_t v = 1; v <= 6; v++) chartRingPush(small, v);
+  TEST_ASSERT_EQUAL_UINT32(4, small.count);
+  TEST_ASSERT_EQUAL_INT(6, chartRingAt(small, 0));
+  TEST_ASSERT_EQUAL_INT(3, chartRingAt(small, 3));
+  free(small.samples);
+}
+
+void test_scrolling_matches_full_redraw(void) {
+  StripChart chart = {};
+  stripChartBegin(chart, ring, 20, 30, CHART_W, CHART_H, 50, 150, 25, TFT_GREEN);
+  for (uint32_t i = 0; i < 3 * CHART_W / 2; i++) {
+    chartRingPush(ring, sample(i));
+    if (i % 3) stripChartUpdate(chart);  // sometimes two samples per update
+  }
+  stripChartUpdate(chart);
+  dmaPushFlush();
+  std::vector<uint16_t> scrolled = grab(20, 30, CHART_W, CHART_H);
+
+  StripChart fresh = {};
+  stripChartBegin(fresh, ring, 20, 30, CHART_W, CHART_H, 50, 150, 25, TFT_GREEN);
+  dmaPushFlush();
+  TEST_ASSERT_TRUE(scrolled == grab(20, 30, CHART_W, CHART_H));
+  stripChartEnd(chart);
+  stripChartEnd(fresh);
+}
+
+void test_newest_sample_is_rightmost(void) {
+  StripChart chart = {};
+  stripChartBegin(chart, ring, 0, 0, CHART_W, CHART_H, 0, 100, 0, TFT_GREEN);
+  chartRingPush(ring, 0);
+  chartRingPush(ring, 100);
+  stripChartUpdate(chart);
+  dmaPushFlush();
+  TEST_ASSERT_EQUAL_HEX16(TFT_GREEN, display.pixelAt(CHART_W - 1, 0));
+  TEST_ASSERT_EQUAL_HEX16(TFT_GREEN, display.pixelAt(CHART_W - 2, CHART_H - 1));
+  stripChartEnd(chart);
+}
+
+void test_update_renders_one_column(void) {
+  StripChart chart = {};
+  stripChartBegin(chart, ring, 0, 0, CHART_W, CHART_H, 0, 200, 0, TFT_GREEN);
+  dmaPushFlush();
+  chartRingPush(ring, 10);
+  display.resetStats();
+  stripChartUpdate(chart);
+  dmaPushFlush();
+  // Rendering touched one column; the push is the two pieces of the chart
+  TEST_ASSERT_EQUAL_UINT32(2, display.stats.windows);
+  TEST_ASSERT_EQUAL_UINT32(CHART_W * CHART_H * 3 + 2 * HOST_WINDOW_BYTES, display.stats.spiBytes);
+  stripChartEnd(chart);
+}
+
+int main(int argc, char** argv) {
+  display.init();
+  display.setRotation(3);
+  initDmaPush();
+  UNITY_BEGIN();
+  RUN_TEST(test_ring_wraps);
+  RUN_TEST(test_scrolling_matches_full_redraw);
+  RUN_TEST(test_newest_sample_is_rightmost);
+  RUN_TEST(test_update_renders_one_column);
+  return UNITY_END();
+}
@@ -0,0 +1,94 @@
+// Fixed-point number formatter, and what it saves over the snprintf the gauges used
+//   pio test -e native -f native/test_text_utils -v
+#include <unity.h>
+#include <Arduino.h>
+#include <stdio.h>
+#include "text_utils.h"
+
+static void checkFormat(const char* expected, int32_t value, uint8_t decimals, uint8_t width = 0) {
+  char buf[FORMAT_FIXED_MAX + 8];
+  memset(buf, 'x', sizeof(buf));
+  uint8_t len = formatFixed(buf, value, decimals, width);
+  TEST_ASSERT_EQUAL_STRING(expected, buf);
+  TEST_ASSERT_EQUAL_INT(strlen(expected), len);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_integers(void) {
+  checkFormat("0", 0, 0);
+  checkFormat("7", 7, 0);
+  checkFormat("6000", 6000, 0);
+  checkFormat("-40", -40, 0);
+  checkFormat("2147483647", INT32_MAX, 0);
+  checkFormat("-2147483648", INT32_MIN, 0);
+}
+
+void test_implied_decimals(void) {
+  checkFormat("14.7", 147, 1);
+  checkFormat("0.0", 0, 1);
+  checkFormat("0.5", 5, 1);
+  checkFormat("-0.5", -5, 1);
+  checkFormat("-12.3", -123, 1);
+  checkFormat("0.05", 5, 2);
+  checkFormat("1.000", 1000, 3);
+  checkFormat("-214748364.8", INT32_MIN, 1);
+  checkFormat("-0.000000005", -5, 12);  // clamped to 9 places
+}
+
+void test_padding(void) {
+  checkFormat("  14.7", 147, 1, 6);
+  checkFormat("   -3", -3, 0, 5);
+  checkFormat("6000", 6000, 0, 2);  // never truncates
+  checkFormat("12.6", 126, 1, 4);
+}
+
+void test_matches_float_formatting(void) {
+  // What drawFloat(value / 10.0, 1) and drawNumber() printed before
+  char expected[24], buf[FORMAT_FIXED_MAX];
+  for (int32_t v = -1000; v <= 1000; v++) {
+    snprintf(expected, sizeof(expected), "%.1f", v / 10.0);
+    formatFixed(buf, v, 1);
+    TEST_ASSERT_EQUAL_STRING(expected, buf);
+    snprintf(expected, sizeof(expected), "%ld", (long)v);
+    formatFixed(buf, v, 0);
+    TEST_ASSERT_EQUAL_STRING(expected, buf);
+  }
+}
+
+void test_benchmark(void) {
+  const int32_t calls = 200000;
+  char buf[24];
+  volatile uint32_t sink = 0;
+
+  uint64_t start = hostNanos();
+  for (int32_t i = 0; i < calls; i++) sink += snprintf(buf, sizeof(buf), "%.1f", (i % 2000) / 10.0);
+  uint64_t floatNs = hostNanos() - start;
+
+  start = hostNanos();
+  for (int32_t i = 0; i < calls; i++) sink += snprintf(buf, sizeof(buf), "%ld", (long)(i % 2000));
+  uint64_t intNs = hostNanos() - start;
+
+  start = hostNanos();
+  for (int32_t i = 0; i < calls; i++) sink += formatFixed(buf, i % 2000, 1);
+  uint64_t fixedNs = hostNanos() - start;
+
+  char line[128];
+  snprintf(line, sizeof(line), "snprintf %%.1f %.1f ns, snprintf %%ld %.1f ns, formatFixed %.1f ns per call",
+           (double)floatNs / calls, (double)intNs / calls, (double)fixedNs / calls);
+  TEST_MESSAGE(line);
+  TEST_ASSERT_TRUE(fixedNs < floatNs);
+  TEST_ASSERT_TRUE(fixedNs < intNs);
+  (void)sink;
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_integers);
+  RUN_TEST(test_implied_decimals);
+  RUN_TEST(test_padding);
+  RUN_TEST(test_matches_float_formatting);
+  RUN_TEST(test_benchmark);
+  return UNITY_END();
+}
@@ -0,0 +1,106 @@
+// Trend page: hardware vertical scrolling, one column per sample
+//   pio test -e native -f native/test_trend_page -v
+#include <unity.h>
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "NotoSansBold15.h"
+
+#define AA_FONT_SMALL NotoSansBold15
+
+TFT_eSPI display = TFT_eSPI();
+
+#include "dma_push.h"
+#include "trend_page.h"
+
+const TrendChannel channels[TREND_CHANNELS] = {
+  { "RPM", 0, 7000, 2000, 0, TFT_YELLOW },
+  { "MAP", 0, 250, 100, 0, TFT_CYAN },
+  { "AFR", 100, 200, 25, 1, TFT_GREEN },
+  { "TPS", 0, 100, 50, 0, TFT_ORANGE },
+};
+static TrendPage page;
+
+static int16_t rpmAt(uint32_t i) { return (int16_t)((i * 733) % 7000); }
+
+static void feed(uint32_t count) {
+  for (uint32_t i = 0; i < count; i++) {
+    int16_t values[TREND_CHANNELS] = { rpmAt(i), 60, 147, 20 };
+    trendPageSample(page, values);
+  }
+  dmaPushFlush();
+}
+
+void setUp(void) {
+  display.setRotation(3);
+  display.fillScreen(TFT_BLACK);
+  display.resetStats();
+}
+
+void tearDown(void) { trendPageEnd(page); }
+
+void test_sample_is_one_column_and_a_scroll(void) {
+  TEST_ASSERT_TRUE(trendPageBegin(page, channels));
+  feed(2);  // past the first panel refresh
+  display.resetStats();
+  int16_t values[TREND_CHANNELS] = { 3000, 60, 147, 20 };
+  trendPageSample(page, values);
+  dmaPushFlush();
+  TEST_ASSERT_EQUAL_UINT32(TREND_COLUMN, display.stats.pixels);
+  // address window + column + VSCRSADD
+  TEST_ASSERT_EQUAL_UINT32(11 + TREND_COLUMN * 3 + 3, display.stats.spiBytes);
+}
+
+// Newest sample just left of the panel, older ones further left, across the wrap
+static void checkScrolledTrace(uint32_t count) {
+  for (uint32_t age = 0; age < TREND_PLOT_W; age++) {
+    int16_t row = trendRow(channels[0], rpmAt(count - 1 - age));
+    TEST_ASSERT_EQUAL_HEX16(TFT_YELLOW, display.pixelAt(TREND_PLOT_W - 1 - age, row));
+  }
+}
+
+void test_plot_scrolls_left_in_rotation_3(void) {
+  TEST_ASSERT_TRUE(trendPageBegin(page, channels));
+  feed(TREND_PLOT_W + 137);
+  checkScrolledTrace(TREND_PLOT_W + 137);
+}
+
+void test_plot_scrolls_left_in_rotation_1(void) {
+  display.setRotation(1);
+  TEST_ASSERT_TRUE(trendPageBegin(page, channels));
+  feed(TREND_PLOT_W + 137);
+  checkScrolledTrace(TREND_PLOT_W + 137);
+}
+
+void test_portrait_is_refused(void) {
+  display.setRotation(0);
+  TEST_ASSERT_FALSE(trendPageBegin(page, channels));
+}
+
+void test_end_restores_plain_addressing(void) {
+  TEST_ASSERT_TRUE(trendPageBegin(page, channels));
+  feed(TREND_PLOT_W + 50);
+  display.resetStats();
+  trendPageEnd(page);
+  // Painted out without a full clear
+  TEST_ASSERT_LESS_THAN(TFT_WIDTH * TFT_HEIGHT / 2, (int)display.stats.pixels);
+  uint32_t lit = 0;
+  for (int32_t y = 0; y < display.height(); y++)
+    for (int32_t x = 0; x < display.width(); x++) lit += display.pixelAt(x, y) != TFT_BLACK;
+  TEST_ASSERT_EQUAL_UINT32(0, lit);
+  display.fillRect(100, 100, 20, 20, TFT_RED);
+  TEST_ASSERT_EQUAL_HEX16(TFT_RED, display.pixelAt(100, 100));
+  TEST_ASSERT_EQUAL_HEX16(TFT_BLACK, display.pixelAt(99, 100));
+}
+
+int main(int argc, char** argv) {
+  (void)argc;
+  (void)argv;
+  initDmaPush();
+  UNITY_BEGIN();
+  RUN_TEST(test_sample_is_one_column_and_a_scroll);
+  RUN_TEST(test_plot_scrolls_left_in_rotation_3);
+  RUN_TEST(test_plot_scrolls_left_in_rotation_1);
+  RUN_TEST(test_portrait_is_refused);
+  RUN_TEST(test_end_restores_plain_addressing);
+  return UNITY_END();
+}
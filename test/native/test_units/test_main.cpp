@@ -0,0 +1,53 @@
+// Display unit conversions
+//   pio test -e native -f native/test_units
+#include <unity.h>
+#include <math.h>
+#include "units.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_fahrenheit_table(void) {
+  TEST_ASSERT_EQUAL_INT(-40, unitFahrenheit(-40));
+  TEST_ASSERT_EQUAL_INT(32, unitFahrenheit(0));
+  TEST_ASSERT_EQUAL_INT(203, unitFahrenheit(95));
+  TEST_ASSERT_EQUAL_INT(419, unitFahrenheit(215));
+  TEST_ASSERT_EQUAL_INT(419, unitFahrenheit(300));  // past the sensor's range
+  for (int32_t c = -40; c <= 215; c++) {
+    TEST_ASSERT_EQUAL_INT((int32_t)lround(c * 1.8 + 32), unitFahrenheit(c));
+  }
+}
+
+void test_lambda_table(void) {
+  TEST_ASSERT_EQUAL_INT(100, unitLambdaHundredths(147));
+  TEST_ASSERT_EQUAL_INT(88, unitLambdaHundredths(130));
+  TEST_ASSERT_EQUAL_INT(0, unitLambdaHundredths(0));
+  for (int32_t afr = 0; afr < 256; afr++) {
+    TEST_ASSERT_EQUAL_INT((int32_t)lround(afr * 100.0 / 147), unitLambdaHundredths(afr));
+  }
+}
+
+void test_psi_multiplier(void) {
+  TEST_ASSERT_EQUAL_INT(146, unitPsiTenths(101));  // 101.3 kPa is 14.7 psi
+  TEST_ASSERT_EQUAL_INT(0, unitPsiTenths(0));
+  TEST_ASSERT_EQUAL_INT(0, unitPsiTenths(-5));
+  TEST_ASSERT_EQUAL_INT(2969, unitPsiTenths(PSI_MAX_KPA + 100));
+  for (int32_t kpa = 0; kpa <= PSI_MAX_KPA; kpa++) {
+    TEST_ASSERT_EQUAL_INT((int32_t)lround(kpa * PSI_PER_KPA * 10), unitPsiTenths(kpa));
+  }
+}
+
+void test_names(void) {
+  TEST_ASSERT_EQUAL_STRING("F", unitName(UNIT_CLT, true));
+  TEST_ASSERT_EQUAL_STRING("kPa", unitName(UNIT_MAP, false));
+  TEST_ASSERT_EQUAL_STRING("afr", unitChannelName(UNIT_AFR));
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_fahrenheit_table);
+  RUN_TEST(test_lambda_table);
+  RUN_TEST(test_psi_multiplier);
+  RUN_TEST(test_names);
+  return UNITY_END();
+}
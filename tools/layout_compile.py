@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""Compile a main page layout from JSON into the firmware's /layout.bin.
+
+    python3 tools/layout_compile.py tools/layout_main.json data/layout.bin
+    pio run -t uploadfs
+
+Each widget is a value box: {"channel", "x", "y", "label"} plus optional
+"lazy" (redraw once a second), "decimals" (0 or 1), "color" and "labelColor".
+"color" is a colour name, "#rrggbb", or one of the rules "afr", "clt", "bat"
+that colour the value by its reading. The checks mirror layoutParse() in
+src/layout.h, so a file this accepts is one the firmware will load.
+"""
+
+import json
+import os
+import re
+import struct
+import sys
+
+CHANNELS = ["afr", "tps", "adv", "map", "iat", "clt", "bat", "fps"]
+COLOR_RULES = {"afr": 1, "clt": 2, "bat": 3}
+COLORS = {
+    "black": 0x0000, "white": 0xFFFF, "red": 0xF800, "green": 0x07E0, "blue": 0x001F,
+    "yellow": 0xFFE0, "cyan": 0x07FF, "magenta": 0xF81F, "orange": 0xFDA0, "darkgrey": 0x7BEF,
+}
+
+SCREEN_W, SCREEN_H = 480, 320
+BOX_W, BOX_H = 100, 65
+LABEL_LEN = 12
+# Labels are drawn in this font, centred over the box
+LABEL_FONT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "NotoSansBold15.h")
+# Drawn by the main page whatever the layout says: (x, y, w, h, what)
+RESERVED = [
+    (120, 45, 240, 105, "the RPM bar"),
+    (220, 120, 40, 18, "the RPM label"),
+    (190, 140, 100, 50, "the RPM readout"),
+    (10, 285, 470, 30, "the status row"),
+]
+LAZY = 0x01
+DECIMALS_SHIFT = 1
+
+
+def rgb565(value):
+    if value in COLORS:
+        return COLORS[value]
+    if isinstance(value, str) and value.startswith("#") and len(value) == 7:
+        r, g, b = (int(value[i:i + 2], 16) for i in (1, 3, 5))
+        return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+    raise ValueError("unknown colour %r" % (value,))
+
+
+def load_font_widths(path):
+    """Map each glyph in a .vlw font array to (advance, width as the last glyph)."""
+    with open(path) as f:
+        text = f.read()
+    data = bytes(int(h, 16) for h in re.findall(r"0x([0-9A-Fa-f]{2})", text.split("PROGMEM", 1)[1]))
+    count, y_advance = struct.unpack(">I4xI", data[:12])
+    glyphs = {}
+    for i in range(count):
+        code, _, width, advance, _, dx = struct.unpack(">IIIIii", data[24 + 28 * i:48 + 28 * i])
+        glyphs[chr(code)] = (advance, max(advance, dx + width))
+    return glyphs, y_advance // 4 + 1
+
+
+def label_width(label, font):
+    """Width of `label` as TFT_eSPI's textWidth() measures it."""
+    glyphs, missing = font
+    width = 0
+    for i, c in enumerate(label):
+        if c not in glyphs:
+            width += missing
+        else:
+            width += glyphs[c][1] if i == len(label) - 1 else glyphs[c][0]
+    return width
+
+
+def overlap(a, b):
+    return a[0] < b[0] + BOX_W and b[0] < a[0] + BOX_W and a[1] < b[1] + BOX_H and b[1] < a[1] + BOX_H
+
+
+def compile_layout(layout):
+    font = load_font_widths(LABEL_FONT)
+    widgets = layout["widgets"]
+    if not 0 < len(widgets) <= len(CHANNELS):
+        raise ValueError("need 1 to %d widgets" % len(CHANNELS))
+    records, boxes, seen = [], [], set()
+    for w in widgets:
+        name = w["channel"]
+        if name not in CHANNELS or name in seen:
+            raise ValueError("%s: unknown or repeated channel" % name)
+        seen.add(name)
+        x, y = w["x"], w["y"]
+        if x < 0 or y < 0 or x + BOX_W > SCREEN_W or y + BOX_H > SCREEN_H:
+            raise ValueError("%s: box at (%d, %d) is off screen" % (name, x, y))
+        for rx, ry, rw, rh, what in RESERVED:
+            if x < rx + rw and rx < x + BOX_W and y < ry + rh and ry < y + BOX_H:
+                raise ValueError("%s: box at (%d, %d) covers %s" % (name, x, y, what))
+        for other, box in boxes:
+            if overlap((x, y), box):
+                raise ValueError("%s overlaps %s" % (name, other))
+        boxes.append((name, (x, y)))
+        label = w["label"].encode("ascii")
+        if len(label) >= LABEL_LEN:
+            raise ValueError("%s: label longer than %d characters" % (name, LABEL_LEN - 1))
+        if not all(0x20 <= c <= 0x7E for c in label):
+            raise ValueError("%s: label must be printable ASCII" % name)
+        width = label_width(label.decode(), font)
+        if width > BOX_W:
+            raise ValueError("%s: label is %d px wide, over the %d px box" % (name, width, BOX_W))
+        decimals = w.get("decimals", 0)
+        if decimals not in (0, 1):
+            raise ValueError("%s: decimals must be 0 or 1" % name)
+        flags = (LAZY if w.get("lazy") else 0) | (decimals << DECIMALS_SHIFT)
+        color = w.get("color", "white")
+        rule = COLOR_RULES.get(color, 0)
+        value_color = COLORS["white"] if rule else rgb565(color)
+        label_color = rgb565(w.get("labelColor", "white"))
+        records.append(struct.pack("<BBBBhhHH12s", CHANNELS.index(name), flags, rule, 0, x, y, value_color,
+                                   label_color, label))
+    return b"MZL1" + struct.pack("<B3x", len(records)) + b"".join(records)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: layout_compile.py layout.json layout.bin")
+    with open(sys.argv[1]) as f:
+        try:
+            data = compile_layout(json.load(f))
+        except (KeyError, ValueError) as e:
+            sys.exit("layout_compile: %s" % e)
+    with open(sys.argv[2], "wb") as f:
+        f.write(data)
+    print("%s: %d widgets, %d bytes" % (sys.argv[2], data[4], len(data)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""Pack the splash logos into src/splash/splash_assets.h.
+
+    python3 tools/splash_pack.py src/splash/splash_assets.h \\
+        "ZetTech ECU=tools/splash/zettech.pbm" \\
+        "Mazduino ECU=tools/splash/mazduino.pbm" \\
+        "Speeduino ECU=tools/splash/speeduino.pbm"
+
+Each argument is "name=image". Binary PBM (P4) files are read directly; any
+other image, such as the originals in data/, needs Pillow and is scaled to
+fit 480x320, centred on black and thresholded at half brightness. The first
+image is the default splash.
+
+The pack is the format read by src/splash/splash_pack.h: an "SPK1" header,
+one 28-byte entry per image (name, size, stream offset and length) and the
+streams. A stream is the image's pixels in
+raster order as alternating runs, clear first, each length one byte below
+0x80 or two bytes big-endian with the top bit set.
+"""
+
+import struct
+import sys
+
+SCREEN_W, SCREEN_H = 480, 320
+NAME_LEN = 16
+MAX_RUN = 0x7FFF
+HEADER = struct.Struct("<4sB3x")
+ENTRY = struct.Struct("<16sHHII")
+
+
+def read_pbm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    fields, pos = [], 0
+    while len(fields) < 3:  # magic, width, height; '#' comments allowed between
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(data[pos:end])
+        pos = end
+    if fields[0] != b"P4":
+        raise ValueError("%s: not a binary PBM" % path)
+    w, h = int(fields[1]), int(fields[2])
+    bits = data[pos + 1:pos + 1 + (w + 7) // 8 * h]
+    if len(bits) != (w + 7) // 8 * h:
+        raise ValueError("%s: truncated" % path)
+    return w, h, bits
+
+
+def read_image(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        raise ValueError("%s: reading this needs Pillow (pip install pillow), or convert it to PBM" % path)
+    img = Image.open(path).convert("L")
+    img.thumbnail((SCREEN_W, SCREEN_H))
+    canvas = Image.new("L", (SCREEN_W, SCREEN_H), 0)
+    canvas.paste(img, ((SCREEN_W - img.width) // 2, (SCREEN_H - img.height) // 2))
+    mono = canvas.point(lambda v: 255 if v >= 128 else 0).convert("1")
+    return SCREEN_W, SCREEN_H, mono.tobytes()  # 1 = white, MSB first, rows padded
+
+
+def load(path):
+    if path.lower().endswith(".pbm"):
+        return read_pbm(path)
+    return read_image(path)
+
+
+def pixels(w, h, bits):
+    stride = (w + 7) // 8
+    for y in range(h):
+        row = bits[y * stride:(y + 1) * stride]
+        for x in range(w):
+            yield (row[x >> 3] >> (7 - (x & 7))) & 1
+
+
+def encode_runs(w, h, bits):
+    out = bytearray()
+
+    def put(n):
+        out.extend(bytes([n]) if n < 0x80 else struct.pack(">H", 0x8000 | n))
+
+    color, run = 0, 0
+    for p in pixels(w, h, bits):
+        if p != color:
+            put(run)
+            color, run = p, 0
+        if run == MAX_RUN:
+            put(run)
+            put(0)  # empty run of the other colour, then carry on
+            run = 0
+        run += 1
+    put(run)
+    return bytes(out)
+
+
+def decode_runs(stream, count):
+    out, color, pos = [], 1, 0
+    while len(out) < count:
+        color ^= 1
+        n = stream[pos]
+        pos += 1
+        if n & 0x80:
+            n = ((n & 0x7F) << 8) | stream[pos]
+            pos += 1
+        out.extend([color] * n)
+    return out
+
+
+def build_pack(images):
+    entries, streams = [], []
+    offset = HEADER.size + ENTRY.size * len(images)
+    for name, (w, h, bits) in images:
+        if w > SCREEN_W or h > SCREEN_H or w & 1:
+            raise ValueError("%s: %dx%d must be an even width and fit %dx%d" % (name, w, h, SCREEN_W, SCREEN_H))
+        label = name.encode("ascii")
+        if len(label) >= NAME_LEN:
+            raise ValueError("%s: name longer than %d characters" % (name, NAME_LEN - 1))
+        stream = encode_runs(w, h, bits)
+        if decode_runs(stream, w * h) != list(pixels(w, h, bits)):
+            raise ValueError("%s: stream does not round-trip" % name)
+        entries.append(ENTRY.pack(label, w, h, offset, len(stream)))
+        streams.append(stream)
+        offset += len(stream)
+    return HEADER.pack(b"SPK1", len(images)) + b"".join(entries) + b"".join(streams)
+
+
+def write_header(path, pack, images):
+    lines = [
+        "// Generated by tools/splash_pack.py from the splash images; rerun it rather than editing.",
+        "#ifndef SPLASH_ASSETS_H",
+        "#define SPLASH_ASSETS_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+    ]
+    for name, (w, h, bits) in images:
+        lines.append("// %-15s %dx%d, %5d B unpacked" % (name, w, h, len(bits)))
+    lines += ["#define SPLASH_PACK_COUNT %d" % len(images), "", "const uint8_t splashPack[%d] PROGMEM = {" % len(pack)]
+    for i in range(0, len(pack), 16):
+        lines.append("  " + " ".join("0x%02x," % b for b in pack[i:i + 16]))
+    lines += ["};", "", "#endif", ""]
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    if len(sys.argv) < 3 or any("=" not in a for a in sys.argv[2:]):
+        sys.exit("usage: splash_pack.py splash_assets.h name=image [name=image ...]")
+    try:
+        images = [(name, load(path)) for name, path in (a.split("=", 1) for a in sys.argv[2:])]
+        pack = build_pack(images)
+    except (OSError, ValueError) as e:
+        sys.exit("splash_pack: %s" % e)
+    write_header(sys.argv[1], pack, images)
+    raw = sum(len(bits) for _, (w, h, bits) in images)
+    print("%s: %d images, %d bytes (%d unpacked)" % (sys.argv[1], len(images), len(pack), raw))
+
+
+if __name__ == "__main__":
+    main()